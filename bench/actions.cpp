@@ -0,0 +1,235 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 21:41:05 CEST
+ * @description : range actions against the standard algorithms and hand-written loops
+ */
+
+#include <brun/callables/actions.hpp>
+#include <brun/callables/arithmetic.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+namespace cb = callables;
+
+namespace
+{
+auto make_numbers(std::size_t size)
+{
+    auto numbers = std::vector<std::int64_t>(size);
+    auto state = std::uint64_t{42};
+    for (auto & n : numbers) {
+        state = state * 6364136223846793005u + 1442695040888963407u;
+        n = static_cast<std::int64_t>(state >> 40) - (1 << 23);
+    }
+    return numbers;
+}
+
+struct box
+{
+    std::int64_t id;
+    double weight;
+};
+
+auto make_boxes(std::size_t size)
+{
+    auto boxes = std::vector<box>{};
+    boxes.reserve(size);
+    for (auto n : make_numbers(size)) {
+        boxes.push_back({n, static_cast<double>(n % 100)});
+    }
+    return boxes;
+}
+}  // namespace
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ....................................FOLD.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void fold_plus(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::fold(numbers, std::int64_t{}, cb::plus));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fold_plus)->Range(1 << 10, 1 << 22);
+
+static void fold_plus_par_unseq(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::fold(numbers, std::int64_t{}, cb::plus, cb::exec::par_unseq));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fold_plus_par_unseq)->Range(1 << 10, 1 << 22)->UseRealTime();
+
+static void fold_plus_loop(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto total = std::int64_t{};
+        for (auto n : numbers) {
+            total += n;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fold_plus_loop)->Range(1 << 10, 1 << 22);
+
+static void fold_projection(benchmark::State & state)
+{
+    auto const boxes = make_boxes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::fold(boxes, 0., cb::plus, &box::weight));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fold_projection)->Range(1 << 10, 1 << 22);
+
+static void fold_projection_transform_view(benchmark::State & state)
+{
+    auto const boxes = make_boxes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto const weights = boxes | std::views::transform(&box::weight);
+        benchmark::DoNotOptimize(std::ranges::fold_left(weights, 0., std::plus{}));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fold_projection_transform_view)->Range(1 << 10, 1 << 22);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// .............................SELECT / COMPACT............................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// half of the numbers are negative, in no predictable order
+static void select_negative(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::select(numbers, cb::less_than(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(select_negative)->Range(1 << 10, 1 << 22);
+
+static void select_negative_filter_view(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto selection = std::vector<std::size_t>{};
+        auto negative = [&](std::size_t i) { return numbers[i] < 0; };
+        for (auto i : std::views::iota(std::size_t{}, numbers.size()) | std::views::filter(negative)) {
+            selection.push_back(i);
+        }
+        benchmark::DoNotOptimize(selection);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(select_negative_filter_view)->Range(1 << 10, 1 << 22);
+
+static void compact_negative(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = numbers;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(cb::compact(copy, cb::less_than(0)).size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(compact_negative)->Range(1 << 10, 1 << 22);
+
+static void compact_negative_std(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = numbers;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(std::ranges::remove_if(copy, [](std::int64_t x) { return x >= 0; }).begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(compact_negative_std)->Range(1 << 10, 1 << 22);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ....................................SORT.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void sort_integers(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = numbers;
+        state.ResumeTiming();
+        cb::sort(copy);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sort_integers)->Range(1 << 10, 1 << 22);
+
+static void sort_integers_par(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = numbers;
+        state.ResumeTiming();
+        cb::sort.par(copy);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sort_integers_par)->Range(1 << 10, 1 << 22)->UseRealTime();
+
+static void sort_integers_std(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = numbers;
+        state.ResumeTiming();
+        std::ranges::sort(copy);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sort_integers_std)->Range(1 << 10, 1 << 22);
+
+static void sort_projection(benchmark::State & state)
+{
+    auto const boxes = make_boxes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = boxes;
+        state.ResumeTiming();
+        cb::sort(copy, cb::less_than, &box::weight);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sort_projection)->Range(1 << 10, 1 << 22);
+
+static void sort_projection_std(benchmark::State & state)
+{
+    auto const boxes = make_boxes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto copy = boxes;
+        state.ResumeTiming();
+        std::ranges::sort(copy, std::ranges::less{}, &box::weight);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(sort_projection_std)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,29 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 23:14:48 CEST
+ * @description : compile-time cost of CB_INSTANTIATIONS distinct `composed<...>` specializations
+ */
+
+#include <brun/callables/combinators.hpp>
+
+#include <array>
+#include <utility>
+
+#ifndef CB_INSTANTIATIONS
+#define CB_INSTANTIATIONS 100
+#endif
+
+namespace cb = callables;
+
+template <int I>
+struct add_fn {
+    constexpr auto operator()(int x) const { return x + I; }
+};
+
+template <std::size_t ...Is>
+auto instantiate(std::index_sequence<Is...>)
+{
+    return std::array{cb::compose(add_fn<Is>{}, add_fn<Is + 1>{}, add_fn<Is + 2>{})(0)...};
+}
+
+auto run() { return instantiate(std::make_index_sequence<CB_INSTANTIATIONS>{}); }
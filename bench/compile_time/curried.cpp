@@ -0,0 +1,29 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 23:16:31 CEST
+ * @description : compile-time cost of CB_INSTANTIATIONS distinct `curried<...>` specializations
+ */
+
+#include <brun/callables/combinators.hpp>
+
+#include <array>
+#include <utility>
+
+#ifndef CB_INSTANTIATIONS
+#define CB_INSTANTIATIONS 100
+#endif
+
+namespace cb = callables;
+
+template <int I>
+struct multiply_add_fn {
+    constexpr auto operator()(int a, int b, int c) const { return a * b + c + I; }
+};
+
+template <std::size_t ...Is>
+auto instantiate(std::index_sequence<Is...>)
+{
+    return std::array{cb::curry(cb::curry(multiply_add_fn<Is>{}, 1), 2)(3)...};
+}
+
+auto run() { return instantiate(std::make_index_sequence<CB_INSTANTIATIONS>{}); }
@@ -0,0 +1,7 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 23:12:05 CEST
+ * @description : compile-time cost of including CB_HEADER alone
+ */
+
+#include CB_HEADER
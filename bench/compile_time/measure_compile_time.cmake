@@ -0,0 +1,114 @@
+######################################################################
+# @author      : Riccardo Brugo (brugo.riccardo@gmail.com)
+# @file        : measure_compile_time
+# @created     : Saturday Oct 17, 2026 23:24:37 CEST
+#
+# Runs the front-end of COMPILER (`-fsyntax-only -ftime-report`) on every header in HEADERS, alone,
+#  and on every translation unit in SOURCES, each one instantiating INSTANTIATIONS distinct
+#  specializations of a class template; then prints the front-end time and memory of each of them
+#  and writes them as JSON to OUTPUT. Memory and template instantiation time are only reported by GCC.
+#  Usage: cmake -DCOMPILER=<c++> -DFLAGS=<list> -DHEADERS=<list> -DHEADER_SOURCE=<header.cpp>
+#               -DSOURCES=<list> -DINSTANTIATIONS=<n> -DOUTPUT=<file.json> -P measure_compile_time.cmake
+######################################################################
+
+cmake_minimum_required(VERSION 3.16.2)
+
+# GCC prints the memory with a unit suffix (`7851k`, `30M`)
+function(to_kilobytes value out)
+    if (value MATCHES "^([0-9.]+)([kMG]?)$")
+        set(number "${CMAKE_MATCH_1}")
+        if (CMAKE_MATCH_2 STREQUAL "")
+            math(EXPR number "${number} / 1024")
+        elseif (CMAKE_MATCH_2 STREQUAL "M")
+            math(EXPR number "${number} * 1024")
+        elseif (CMAKE_MATCH_2 STREQUAL "G")
+            math(EXPR number "${number} * 1024 * 1024")
+        endif()
+        set(${out} "${number}" PARENT_SCOPE)
+    else()
+        set(${out} "null" PARENT_SCOPE)
+    endif()
+endfunction()
+
+# sets `<prefix>_wall`, `<prefix>_instantiation` (seconds) and `<prefix>_memory` (kB), or `null`
+function(parse_time_report report prefix)
+    set(wall "null")
+    set(instantiation "null")
+    set(memory "null")
+    set(number "[0-9]+\\.[0-9]+")
+    set(percent "\\( *[0-9]+%\\)")
+    if (report MATCHES "\n TOTAL +: +(${number}) +(${number}) +(${number}) +([0-9]+[kMG]?)")
+        # GCC: usr, sys, wall, GGC memory
+        set(wall "${CMAKE_MATCH_3}")
+        to_kilobytes("${CMAKE_MATCH_4}" memory)
+        if (report MATCHES "\n template instantiation +: +${number} +${percent} +${number} +${percent} +(${number})")
+            set(instantiation "${CMAKE_MATCH_1}")
+        endif()
+    elseif (report MATCHES "Clang front-end time report[^\n]*\n[^T]*Total Execution Time: [0-9.]+ seconds \\(([0-9.]+) wall clock\\)")
+        set(wall "${CMAKE_MATCH_1}")
+    endif()
+    set(${prefix}_wall "${wall}" PARENT_SCOPE)
+    set(${prefix}_instantiation "${instantiation}" PARENT_SCOPE)
+    set(${prefix}_memory "${memory}" PARENT_SCOPE)
+endfunction()
+
+set(failed "")
+set(json_units "")
+
+function(measure name kind)
+    execute_process(
+        COMMAND ${COMPILER} ${FLAGS} -fsyntax-only -ftime-report ${ARGN}
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE report
+        RESULT_VARIABLE result
+    )
+    if (NOT result EQUAL 0)
+        message(WARNING "cannot compile ${name}:\n${report}")
+        set(failed ${failed} "${name}" PARENT_SCOPE)
+        return()
+    endif()
+    parse_time_report("${report}" unit)
+    set(row "${name}")
+    string(LENGTH "${row}" length)
+    foreach(padding RANGE ${length} 48)
+        string(APPEND row " ")
+    endforeach()
+    string(APPEND row "${unit_wall} s")
+    if (NOT unit_instantiation STREQUAL "null")
+        string(APPEND row "  (instantiation: ${unit_instantiation} s)")
+    endif()
+    if (NOT unit_memory STREQUAL "null")
+        string(APPEND row "  ${unit_memory} kB")
+    endif()
+    message(STATUS "${row}")
+
+    set(unit "{\"name\": \"${name}\", \"kind\": \"${kind}\", \"wall_seconds\": ${unit_wall}")
+    string(APPEND unit ", \"instantiation_seconds\": ${unit_instantiation}, \"memory_kb\": ${unit_memory}}")
+    set(json_units ${json_units} "${unit}" PARENT_SCOPE)
+endfunction()
+
+message(STATUS "front-end time and memory of each header, alone:")
+foreach(header IN LISTS HEADERS)
+    measure("${header}" header "-DCB_HEADER=<${header}>" ${HEADER_SOURCE})
+endforeach()
+
+message(STATUS "front-end time and memory of ${INSTANTIATIONS} distinct specializations:")
+foreach(source IN LISTS SOURCES)
+    get_filename_component(name "${source}" NAME_WE)
+    measure("${name}" instantiations "-DCB_INSTANTIATIONS=${INSTANTIATIONS}" ${source})
+endforeach()
+
+execute_process(COMMAND ${COMPILER} --version OUTPUT_VARIABLE version)
+string(REGEX REPLACE "\n.*" "" version "${version}")
+string(REPLACE "\"" "\\\"" version "${version}")
+string(REPLACE ";" ",\n    " json_units "${json_units}")
+file(WRITE "${OUTPUT}"
+    "{\n  \"compiler\": \"${version}\",\n  \"instantiations\": ${INSTANTIATIONS},\n"
+    "  \"units\": [\n    ${json_units}\n  ]\n}\n"
+)
+message(STATUS "results written to ${OUTPUT}")
+
+if (failed)
+    list(JOIN failed ", " failed)
+    message(FATAL_ERROR "cannot compile: ${failed}")
+endif()
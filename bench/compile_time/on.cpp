@@ -0,0 +1,30 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 23:18:09 CEST
+ * @description : compile-time cost of CB_INSTANTIATIONS distinct `on_fn::inner<...>` specializations
+ */
+
+#include <brun/callables/combinators.hpp>
+#include <brun/callables/comparison.hpp>
+
+#include <array>
+#include <utility>
+
+#ifndef CB_INSTANTIATIONS
+#define CB_INSTANTIATIONS 100
+#endif
+
+namespace cb = callables;
+
+template <int I>
+struct key_fn {
+    constexpr auto operator()(int x) const { return x % (I + 1); }
+};
+
+template <std::size_t ...Is>
+auto instantiate(std::index_sequence<Is...>)
+{
+    return std::array{cb::on(key_fn<Is>{}, cb::equal_to)(1, 2)...};
+}
+
+auto run() { return instantiate(std::make_index_sequence<CB_INSTANTIATIONS>{}); }
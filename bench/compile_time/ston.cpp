@@ -0,0 +1,37 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 23:20:52 CEST
+ * @description : compile-time cost of CB_INSTANTIATIONS distinct `ston_fn<...>` specializations
+ */
+
+#include <brun/callables/format.hpp>
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#ifndef CB_INSTANTIATIONS
+#define CB_INSTANTIATIONS 100
+#endif
+
+namespace cb = callables;
+
+// every base from 2 to 32 for every integer type: 248 distinct specializations, then they repeat
+using numbers = std::tuple<
+    std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t
+>;
+
+template <std::size_t I>
+using number_t = std::tuple_element_t<I % std::tuple_size_v<numbers>, numbers>;
+
+template <std::size_t I>
+constexpr auto base = static_cast<int>(2 + I / std::tuple_size_v<numbers> % 31);
+
+template <std::size_t ...Is>
+auto instantiate(std::index_sequence<Is...>)
+{
+    return std::array{static_cast<long long>(cb::ston<number_t<Is>, base<Is>>("101"))...};
+}
+
+auto run() { return instantiate(std::make_index_sequence<CB_INSTANTIATIONS>{}); }
@@ -0,0 +1,205 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 21:26:40 CEST
+ * @description : string conversions against the standard library
+ */
+
+#include <brun/callables/format.hpp>
+#include <benchmark/benchmark.h>
+
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cb = callables;
+
+namespace
+{
+auto make_numbers(std::size_t size)
+{
+    auto numbers = std::vector<int>(size);
+    auto state = std::uint32_t{42};
+    for (auto & n : numbers) {
+        state = state * 1664525u + 1013904223u;
+        n = static_cast<int>(state) >> 4;
+    }
+    return numbers;
+}
+
+auto make_fields(std::size_t size)
+{
+    auto fields = std::vector<std::string>{};
+    fields.reserve(size);
+    for (auto n : make_numbers(size)) {
+        fields.push_back(std::to_string(n));
+    }
+    return fields;
+}
+
+constexpr auto size = 1 << 12;
+}  // namespace
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ....................................STON.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void ston_int(benchmark::State & state)
+{
+    auto const fields = make_fields(size);
+    for (auto _ : state) {
+        auto total = std::int64_t{};
+        for (auto const & field : fields) {
+            total += cb::ston<int>(field);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(ston_int);
+
+static void ston_int_from_chars(benchmark::State & state)
+{
+    auto const fields = make_fields(size);
+    for (auto _ : state) {
+        auto total = std::int64_t{};
+        for (auto const & field : fields) {
+            auto value = 0;
+            std::from_chars(field.data(), field.data() + field.size(), value);
+            total += value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(ston_int_from_chars);
+
+static void ston_double(benchmark::State & state)
+{
+    auto fields = make_fields(size);
+    for (auto & field : fields) {
+        field.insert(field.size() / 2, ".");
+    }
+    for (auto _ : state) {
+        auto total = 0.;
+        for (auto const & field : fields) {
+            total += cb::ston<double>(field);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(ston_double);
+
+static void ston_double_from_chars(benchmark::State & state)
+{
+    auto fields = make_fields(size);
+    for (auto & field : fields) {
+        field.insert(field.size() / 2, ".");
+    }
+    for (auto _ : state) {
+        auto total = 0.;
+        for (auto const & field : fields) {
+            auto value = 0.;
+            std::from_chars(field.data(), field.data() + field.size(), value);
+            total += value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(ston_double_from_chars);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..................................TO_STRING................................. //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void to_string_int(benchmark::State & state)
+{
+    auto const numbers = make_numbers(size);
+    for (auto _ : state) {
+        auto total = std::size_t{};
+        for (auto n : numbers) {
+            total += cb::to_string(n).size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(to_string_int);
+
+static void to_string_int_inline(benchmark::State & state)
+{
+    auto const numbers = make_numbers(size);
+    for (auto _ : state) {
+        auto total = std::size_t{};
+        for (auto n : numbers) {
+            total += cb::to_string.inline_<16>(n).size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(to_string_int_inline);
+
+static void to_string_int_std_format(benchmark::State & state)
+{
+    auto const numbers = make_numbers(size);
+    for (auto _ : state) {
+        auto total = std::size_t{};
+        for (auto n : numbers) {
+            total += std::format("{}", n).size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(to_string_int_std_format);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...................................FORMAT................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void format_runtime(benchmark::State & state)
+{
+    auto const numbers = make_numbers(size);
+    auto buffer = std::string{};
+    for (auto _ : state) {
+        for (auto n : numbers) {
+            cb::format<"id={} value={}">.to_string_into(buffer, n, n / 3);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(format_runtime);
+
+static void format_compiled(benchmark::State & state)
+{
+    auto const numbers = make_numbers(size);
+    auto buffer = std::string{};
+    for (auto _ : state) {
+        for (auto n : numbers) {
+            cb::format<"id={} value={}">.compiled.to_string_into(buffer, n, n / 3);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(format_compiled);
+
+static void format_std(benchmark::State & state)
+{
+    auto const numbers = make_numbers(size);
+    auto buffer = std::string{};
+    for (auto _ : state) {
+        for (auto n : numbers) {
+            buffer.clear();
+            std::format_to(std::back_inserter(buffer), "id={} value={}", n, n / 3);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(format_std);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,510 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 21:04:12 CEST
+ * @description : function objects against the equivalent lambdas, over range pipelines
+ */
+
+#include <brun/callables/arithmetic.hpp>
+#include <brun/callables/combinators.hpp>
+#include <brun/callables/ordering.hpp>
+#include <brun/callables/simd.hpp>
+#include <brun/callables/functional/functor.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace cb = callables;
+
+namespace
+{
+auto make_numbers(std::size_t size)
+{
+    auto numbers = std::vector<int>(size);
+    auto state = std::uint32_t{42};
+    for (auto & n : numbers) {
+        state = state * 1664525u + 1013904223u;
+        n = static_cast<int>(state >> 16);
+    }
+    return numbers;
+}
+
+auto make_words(std::size_t size)
+{
+    auto words = std::vector<std::string>{};
+    words.reserve(size);
+    for (auto n : make_numbers(size)) {
+        words.emplace_back(static_cast<std::size_t>(n % 32), 'x');
+    }
+    return words;
+}
+
+constexpr auto len = [](std::string const & s) { return s.size(); };
+
+// Sums `rng` after `fn`, so that the whole pipeline is measured
+template <typename Fn>
+auto sum_transformed(std::vector<int> const & numbers, Fn fn)
+{
+    auto const transformed = numbers | std::views::transform(fn);
+    return std::accumulate(transformed.begin(), transformed.end(), std::int64_t{});
+}
+}  // namespace
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ....................................PLUS.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void plus_partial(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, cb::plus(1)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(plus_partial)->Range(1 << 10, 1 << 20);
+
+static void plus_lambda(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, [](int x) { return x + 1; }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(plus_lambda)->Range(1 << 10, 1 << 20);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// .....................................ON..................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void on_len_less_than(benchmark::State & state)
+{
+    auto const words = make_words(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto copy = words;
+        std::ranges::sort(copy, cb::on(len, cb::less_than));
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(on_len_less_than)->Range(1 << 10, 1 << 16);
+
+static void on_len_less_than_lambda(benchmark::State & state)
+{
+    auto const words = make_words(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto copy = words;
+        std::ranges::sort(copy, [](auto const & a, auto const & b) { return a.size() < b.size(); });
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(on_len_less_than_lambda)->Range(1 << 10, 1 << 16);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..................................COMPOSE................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void compose_three(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto const fn = cb::compose(cb::plus(1), cb::multiplies(3), cb::minus(7));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, fn));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(compose_three)->Range(1 << 10, 1 << 20);
+
+static void compose_three_lambda(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, [](int x) { return 1 + 3 * (7 - x); }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(compose_three_lambda)->Range(1 << 10, 1 << 20);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...................................CURRY.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void curry_bound(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto const add = cb::curry([](int a, int b, int c) { return a + b * c; });
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, [&](int x) { return add(x, 2)(3); }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(curry_bound)->Range(1 << 10, 1 << 20);
+
+static void curry_bound_lambda(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, [](int x) { return x + 2 * 3; }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(curry_bound_lambda)->Range(1 << 10, 1 << 20);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ....................................FLIP.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void flip_minus(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(numbers.begin(), numbers.end(), std::int64_t{}, cb::flip(cb::minus)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(flip_minus)->Range(1 << 10, 1 << 20);
+
+static void flip_minus_lambda(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(
+            numbers.begin(), numbers.end(), std::int64_t{}, [](std::int64_t a, int b) { return b - a; }
+        ));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(flip_minus_lambda)->Range(1 << 10, 1 << 20);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..............................DIVIDES, MODULUS.............................. //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// the divisor is only known at runtime, as the number of buckets of a hash table
+static void divides_right(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto divisor = 1'000;
+    benchmark::DoNotOptimize(divisor);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, cb::divides.right(divisor)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(divides_right)->Range(1 << 10, 1 << 20);
+
+static void divides_right_lambda(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto divisor = 1'000;
+    benchmark::DoNotOptimize(divisor);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, [divisor](int x) { return x / divisor; }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(divides_right_lambda)->Range(1 << 10, 1 << 20);
+
+static void modulus_right(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto buckets = 769;
+    benchmark::DoNotOptimize(buckets);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, cb::modulus.right(buckets)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(modulus_right)->Range(1 << 10, 1 << 20);
+
+static void modulus_right_lambda(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto buckets = 769;
+    benchmark::DoNotOptimize(buckets);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sum_transformed(numbers, [buckets](int x) { return x % buckets; }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(modulus_right_lambda)->Range(1 << 10, 1 << 20);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// .............................BATCHED PREDICATES............................. //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// the threshold is only known at runtime, and of another type than the elements
+static void eval_mask(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto mask = std::vector<std::uint8_t>(numbers.size());
+    auto threshold = 10'000L;
+    benchmark::DoNotOptimize(threshold);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::simd::eval(cb::less_than(threshold), numbers, std::span{mask}));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(eval_mask)->Range(1 << 10, 1 << 20);
+
+static void eval_bits(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto bits = std::vector<std::uint64_t>((numbers.size() + 63) / 64);
+    auto threshold = 10'000L;
+    benchmark::DoNotOptimize(threshold);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::simd::eval(cb::less_than(threshold), numbers, std::span{bits}));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(eval_bits)->Range(1 << 10, 1 << 20);
+
+static void eval_mask_loop(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto mask = std::vector<std::uint8_t>(numbers.size());
+    auto threshold = 10'000L;
+    benchmark::DoNotOptimize(threshold);
+    for (auto _ : state) {
+        auto const pred = cb::less_than(threshold);
+        auto count = std::size_t{};
+        for (auto i = std::size_t{}; i < numbers.size(); ++i) {
+            mask[i] = pred(numbers[i]);
+            count += mask[i];
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(eval_mask_loop)->Range(1 << 10, 1 << 20);
+
+static void eval_between(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto mask = std::vector<std::uint8_t>(numbers.size());
+    auto high = 20'000;
+    benchmark::DoNotOptimize(high);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cb::simd::eval(cb::between(10'000, high), numbers, std::span{mask}));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(eval_between)->Range(1 << 10, 1 << 20);
+
+static void eval_between_loop(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto mask = std::vector<std::uint8_t>(numbers.size());
+    auto high = 20'000;
+    benchmark::DoNotOptimize(high);
+    for (auto _ : state) {
+        auto const pred = cb::between(10'000, high);
+        auto count = std::size_t{};
+        for (auto i = std::size_t{}; i < numbers.size(); ++i) {
+            mask[i] = pred(numbers[i]);
+            count += mask[i];
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(eval_between_loop)->Range(1 << 10, 1 << 20);
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ....................................FMAP.................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+static void fmap_vector(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto const scaled = cb::fmap([](int x) { return static_cast<float>(x) * .5f; }, numbers);
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector)->Range(1 << 10, 1 << 22);
+
+// the vector is consumed, and its buffer reused
+static void fmap_vector_rvalue(benchmark::State & state)
+{
+    auto numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        numbers = cb::fmap([](int x) { return x * 3 + 1; }, std::move(numbers));
+        benchmark::DoNotOptimize(numbers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector_rvalue)->Range(1 << 10, 1 << 22);
+
+static void fmap_vector_emplace_back(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto scaled = std::vector<float>{};
+        scaled.reserve(numbers.size());
+        for (auto x : numbers) {
+            scaled.emplace_back(static_cast<float>(x) * .5f);
+        }
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector_emplace_back)->Range(1 << 10, 1 << 22);
+
+static void fmap_vector_par(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto const scaled = cb::fmap.par([](int x) { return std::sqrt(std::abs(static_cast<float>(x))) * .5f; }, numbers);
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector_par)->Range(1 << 10, 1 << 22)->UseRealTime();
+
+static void fmap_vector_seq_sqrt(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto const scaled = cb::fmap([](int x) { return std::sqrt(std::abs(static_cast<float>(x))) * .5f; }, numbers);
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector_seq_sqrt)->Range(1 << 10, 1 << 22);
+
+// three maps, each of them materializing a vector
+static void fmap_vector_chain(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto const scaled = cb::fmap([](float x) { return x * .5f; },
+            cb::fmap([](int x) { return static_cast<float>(x); }, cb::fmap([](int x) { return x * 3 + 1; }, numbers)));
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector_chain)->Range(1 << 10, 1 << 22);
+
+// the same maps composed, in a single vector
+static void fmap_vector_lazy_chain(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto const scaled = cb::fmap([](float x) { return x * .5f; },
+            cb::fmap([](int x) { return static_cast<float>(x); }, cb::fmap.lazy([](int x) { return x * 3 + 1; }, numbers)))
+            .eval();
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_vector_lazy_chain)->Range(1 << 10, 1 << 22);
+
+static void fmap_span_into(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto scaled = std::vector<float>(numbers.size());
+    for (auto _ : state) {
+        cb::fmap([](int x) { return static_cast<float>(x) * .5f; }, std::span{numbers}, std::span{scaled});
+        benchmark::DoNotOptimize(scaled.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_span_into)->Range(1 << 10, 1 << 22);
+
+static void fmap_deque(benchmark::State & state)
+{
+    auto const vector = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto const numbers = std::deque<int>(vector.begin(), vector.end());
+    for (auto _ : state) {
+        auto const scaled = cb::fmap([](int x) { return static_cast<float>(x) * .5f; }, numbers);
+        benchmark::DoNotOptimize(&scaled);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_deque)->Range(1 << 10, 1 << 20);
+
+static void fmap_deque_emplace_back(benchmark::State & state)
+{
+    auto const vector = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto const numbers = std::deque<int>(vector.begin(), vector.end());
+    for (auto _ : state) {
+        auto scaled = std::deque<float>{};
+        for (auto x : numbers) {
+            scaled.emplace_back(static_cast<float>(x) * .5f);
+        }
+        benchmark::DoNotOptimize(&scaled);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_deque_emplace_back)->Range(1 << 10, 1 << 20);
+
+// the values of a map with string keys, to another type
+static void fmap_map(benchmark::State & state)
+{
+    auto words = std::map<std::string, int>{};
+    for (auto i = 0; i < state.range(0); ++i) {
+        words.emplace("key number " + std::to_string(i), i);
+    }
+    for (auto _ : state) {
+        auto const scaled = cb::fmap([](int x) { return x * .5; }, words);
+        benchmark::DoNotOptimize(&scaled);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_map)->Range(1 << 10, 1 << 16);
+
+static void fmap_map_insert(benchmark::State & state)
+{
+    auto words = std::map<std::string, int>{};
+    for (auto i = 0; i < state.range(0); ++i) {
+        words.emplace("key number " + std::to_string(i), i);
+    }
+    for (auto _ : state) {
+        auto scaled = std::map<std::string, double>{};
+        for (auto const & [key, value] : words) {
+            scaled.emplace(key, value * .5);
+        }
+        benchmark::DoNotOptimize(&scaled);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fmap_map_insert)->Range(1 << 10, 1 << 16);
+
+// many small maps, each of them allocating its result
+static void fmap_small_vectors(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto i = 0; i < 1000; ++i) {
+            auto const scaled = cb::fmap([](int x) { return x * .5f; }, numbers);
+            benchmark::DoNotOptimize(scaled.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 1000);
+}
+BENCHMARK(fmap_small_vectors)->Range(8, 64);
+
+// the same maps, into an arena released at the end of each iteration
+static void fmap_small_vectors_arena(benchmark::State & state)
+{
+    auto const numbers = make_numbers(static_cast<std::size_t>(state.range(0)));
+    auto buffer = std::vector<std::byte>(1 << 20);
+    for (auto _ : state) {
+        auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+        for (auto i = 0; i < 1000; ++i) {
+            auto const scaled = cb::fmap([](int x) { return x * .5f; }, numbers, &arena);
+            benchmark::DoNotOptimize(scaled.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 1000);
+}
+BENCHMARK(fmap_small_vectors_arena)->Range(8, 64);
+
+BENCHMARK_MAIN();
@@ -34,15 +34,26 @@
 #include <iterator>
 #include <ranges>
 #include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
 
 #include "identity.hpp"
 #include "ordering.hpp"
+#include "simd.hpp"
+#include "traits.hpp"
+#include "detail/parallel.hpp"
+#include "detail/radix_sort.hpp"
 
 #include "detail/_config_begin.hpp"
 
 namespace callables
 {
 
+// all_of / any_of
 // fold (left)
 // sort
 
@@ -53,6 +64,36 @@ template <typename T>
     requires requires() { { T::use_projection } -> std::convertible_to<bool>; }
 constexpr inline auto use_projection<T> = static_cast<bool>(T::use_projection);
 
+namespace detail
+{
+// The type of `proj(*it)`, for an iterator `it` of type `I`
+template <typename I, typename Proj>
+using projected_reference_t = std::invoke_result_t<Proj &, std::iter_reference_t<I>>;
+
+// `op(init, proj(*it))` is valid, so the projections of a range of `I` can be folded from `init`
+template <typename Op, typename Init, typename I, typename Proj>
+concept left_foldable = std::indirectly_readable<I> and std::invocable<Proj &, std::iter_reference_t<I>>
+    and std::invocable<Op &, Init, projected_reference_t<I, Proj>>;
+
+// The same, starting from the projection of the first element
+template <typename Op, typename I, typename Proj>
+concept left_foldable_first = std::indirectly_readable<I> and std::invocable<Proj &, std::iter_reference_t<I>>
+    and left_foldable<Op, std::remove_cvref_t<projected_reference_t<I, Proj>>, I, Proj>;
+}  // namespace detail
+
+// An action which receives `Policy` as last argument, for the pipe launchers
+template <typename Action, typename Policy>
+struct with_policy
+{
+    static constexpr auto use_projection = callables::use_projection<Action>;
+
+    template <typename ...Args>
+    constexpr static auto operator()(Args &&... args) -> decltype(auto)
+    {
+        return Action{}(CB_FWD(args)..., Policy{});
+    }
+};
+
 template <typename Action, typename BinaryOp, typename Proj, typename Init>
 struct action_capture
 {
@@ -61,8 +102,11 @@ struct action_capture
     Init _init;
 
     template <std::ranges::input_range Rng>
-        requires std::invocable<BinaryOp, Init, std::ranges::range_value_t<Rng>>
-        and std::convertible_to<std::invoke_result_t<BinaryOp, Init, std::ranges::range_value_t<Rng>>, Init>
+        requires detail::left_foldable<BinaryOp const, Init, std::ranges::iterator_t<Rng>, Proj const>
+        and std::convertible_to<
+            std::invoke_result_t<BinaryOp const &, Init, detail::projected_reference_t<std::ranges::iterator_t<Rng>, Proj const>>,
+            Init
+        >
     constexpr auto operator()(Rng && rng) const -> decltype(auto)
     {
         if constexpr (use_projection<Action>) {
@@ -80,8 +124,11 @@ struct action_capture<Action, BinaryOp, Proj, Init>
     Init _init;
 
     template <std::ranges::input_range Rng>
-        requires std::invocable<BinaryOp, Init, std::ranges::range_value_t<Rng>>
-        and std::convertible_to<std::invoke_result_t<BinaryOp, Init, std::ranges::range_value_t<Rng>>, Init>
+        requires detail::left_foldable<BinaryOp const, Init, std::ranges::iterator_t<Rng>, Proj const>
+        and std::convertible_to<
+            std::invoke_result_t<BinaryOp const &, Init, detail::projected_reference_t<std::ranges::iterator_t<Rng>, Proj const>>,
+            Init
+        >
     constexpr auto operator()(Rng && rng) const -> decltype(auto)
     {
         if constexpr (use_projection<Action>) {
@@ -99,7 +146,7 @@ struct action_capture<Action, BinaryOp, Proj, void>
     [[no_unique_address]] Proj _proj;
 
     template <std::ranges::input_range Rng>
-        requires std::invocable<BinaryOp, std::ranges::range_value_t<Rng>, std::ranges::range_value_t<Rng>>
+        requires detail::left_foldable_first<BinaryOp const, std::ranges::iterator_t<Rng>, Proj const>
         // and std::convertible_to<
         //     std::invoke_result_t<BinaryOp, std::ranges::range_value_t<Rng>, std::ranges::range_value_t<Rng>>,
         //     std::ranges::range_value_t<Rng>
@@ -119,7 +166,7 @@ template <typename Action, typename BinaryOp, typename Proj>
 struct action_capture<Action, BinaryOp, Proj, void>
 {
     template <std::ranges::input_range Rng>
-        requires std::invocable<BinaryOp, std::ranges::range_value_t<Rng>, std::ranges::range_value_t<Rng>>
+        requires detail::left_foldable_first<BinaryOp const, std::ranges::iterator_t<Rng>, Proj const>
         // and std::convertible_to<
         //     std::invoke_result_t<BinaryOp, std::ranges::range_value_t<Rng>, std::ranges::range_value_t<Rng>>,
         //     std::ranges::range_value_t<Rng>
@@ -141,50 +188,442 @@ constexpr auto operator|(Rng && rng, action_capture<Action, Cb, Proj, I> const &
     return capture(std::forward<Rng>(rng));
 }
 
+// Like `action_capture`, for the actions taking a unary predicate instead of a binary operation
+template <typename Action, typename Pred, typename Proj>
+struct predicate_capture
+{
+    [[no_unique_address]] Pred _pred;
+    [[no_unique_address]] Proj _proj;
+
+    template <std::ranges::input_range Rng>
+        requires std::indirect_unary_predicate<Pred const &, std::projected<std::ranges::iterator_t<Rng>, Proj const &>>
+    constexpr auto operator()(Rng && rng) const -> decltype(auto)
+    {
+        return Action{}(std::forward<Rng>(rng), _pred, _proj);
+    }
+};
+
+template <std::ranges::input_range Rng, typename Action, typename Pred, typename Proj>
+    requires std::invocable<predicate_capture<Action, Pred, Proj>, Rng>
+constexpr auto operator|(Rng && rng, predicate_capture<Action, Pred, Proj> const & capture) -> decltype(auto)
+{
+    return capture(std::forward<Rng>(rng));
+}
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..............................ALL_OF / ANY_OF............................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+namespace detail
+{
+// `all_of` and `any_of` look for the first element whose truth value is `Target`, and stop there
+template <bool Target>
+struct find_truth_value_fn
+{
+    template <
+        std::input_iterator I, std::sentinel_for<I> S,
+        typename Proj = identity_fn, std::indirect_unary_predicate<std::projected<I, Proj>> Pred = identity_fn
+    >
+    constexpr static auto operator()(I first, S last, Pred pred = {}, Proj proj = {}) -> bool
+    {
+        // contiguous booleans and integers are scanned a block at a time
+        if constexpr (
+            std::contiguous_iterator<I> and std::sized_sentinel_for<S, I> and std::integral<std::iter_value_t<I>>
+            and std::same_as<Pred, identity_fn> and std::same_as<Proj, identity_fn>
+        ) {
+            auto const size = static_cast<std::size_t>(last - first);
+            return detail::find_truth_value(std::to_address(first), size, Target) != size;
+        } else {
+            for (; first != last; ++first) {
+                if (static_cast<bool>(std::invoke(pred, std::invoke(proj, *first))) == Target) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    template <
+        std::ranges::input_range Rng, typename Proj = identity_fn,
+        std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<Rng>, Proj>> Pred = identity_fn
+    >
+    constexpr static auto operator()(Rng && rng, Pred pred = {}, Proj proj = {}) -> bool
+    {
+        return operator()(std::ranges::begin(rng), std::ranges::end(rng), std::move(pred), std::move(proj));
+    }
+};
+}  // namespace detail
+
+/**
+ * @brief whether `pred(proj(x))` holds for every element, stopping at the first that fails it;
+ *  without predicate and projection, contiguous ranges of booleans or integers are tested 64 bytes
+ *  at a time
+ */
+struct all_of_fn
+{
+    template <typename ...Args>
+        requires std::invocable<detail::find_truth_value_fn<false>, Args...>
+    constexpr static auto operator()(Args &&... args) -> bool
+    {
+        return not detail::find_truth_value_fn<false>{}(CB_FWD(args)...);
+    }
+
+    // Partial applicator and pipe launcher
+    template <typename Pred = identity_fn, typename Proj = identity_fn>
+        requires (not std::ranges::input_range<Pred> and not std::input_iterator<Pred>)
+    constexpr static auto operator()(Pred pred = {}, Proj proj = {}) noexcept
+    {
+        return predicate_capture<all_of_fn, Pred, Proj>{std::move(pred), std::move(proj)};
+    }
+};
+
+constexpr inline all_of_fn all_of;
+
+/**
+ * @brief whether `pred(proj(x))` holds for some element, stopping at the first that satisfies it;
+ *  without predicate and projection, contiguous ranges of booleans or integers are tested 64 bytes
+ *  at a time
+ */
+struct any_of_fn
+{
+    template <typename ...Args>
+        requires std::invocable<detail::find_truth_value_fn<true>, Args...>
+    constexpr static auto operator()(Args &&... args) -> bool
+    {
+        return detail::find_truth_value_fn<true>{}(CB_FWD(args)...);
+    }
+
+    // Partial applicator and pipe launcher
+    template <typename Pred = identity_fn, typename Proj = identity_fn>
+        requires (not std::ranges::input_range<Pred> and not std::input_iterator<Pred>)
+    constexpr static auto operator()(Pred pred = {}, Proj proj = {}) noexcept
+    {
+        return predicate_capture<any_of_fn, Pred, Proj>{std::move(pred), std::move(proj)};
+    }
+};
+
+constexpr inline any_of_fn any_of;
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// .............................SELECT / COMPACT............................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+namespace detail
+{
+// Whether `select` and `compact` can test the elements of `Rng` a block at a time
+template <typename Rng>
+concept batch_range = std::ranges::contiguous_range<Rng> and std::ranges::sized_range<Rng>;
+
+// Calls `sink(i, selected)` on the position `i` of every element, with `selected` either `0` or `1`: the
+//  elements are tested 64 at a time by `simd::eval`'s predicates, in a loop that the compiler vectorizes, so
+//  that `sink` can use `selected` without branching on it
+template <typename Proj, typename Pred, typename T, typename Sink>
+constexpr void for_each_selection(T * data, std::size_t size, Pred const & pred, Proj & proj, Sink sink)
+{
+    using projected_t = std::remove_cvref_t<std::invoke_result_t<Proj &, T &>>;
+    auto const test = detail::batch_predicate<projected_t>(pred);
+    if (auto const uniform = detail::uniformity(test); uniform != detail::batch_uniformity::each) {
+        auto const selected = static_cast<std::size_t>(uniform == detail::batch_uniformity::all);
+        for (auto i = std::size_t{}; i < size; ++i) {
+            sink(i, selected);
+        }
+        return;
+    }
+    for (auto first = std::size_t{}; first < size; first += 64) {
+        auto const block = std::min<std::size_t>(size - first, 64);
+        std::uint8_t selected[64] = {};
+        for (auto i = std::size_t{}; i < block; ++i) {
+            selected[i] = static_cast<std::uint8_t>(test(std::invoke(proj, data[first + i])));
+        }
+        for (auto i = std::size_t{}; i < block; ++i) {
+            sink(first + i, static_cast<std::size_t>(selected[i]));
+        }
+    }
+}
+}  // namespace detail
+
+/**
+ * @brief the positions of the elements for which `pred(proj(x))` holds, in increasing order. Contiguous
+ *  ranges are tested a block at a time and the positions are written without branching on the result,
+ *  which is much faster than a filtering loop when the selected elements are not predictable;
+ *  comparisons with a bound integer and `between` take a single vector compare (see `simd::eval`)
+ */
+struct select_fn
+{
+    template <
+        std::ranges::input_range Rng, typename Proj = identity_fn,
+        std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<Rng>, Proj>> Pred
+    >
+    constexpr static auto operator()(Rng && rng, Pred pred, Proj proj = {}) -> std::vector<std::size_t>
+    {
+        auto selection = std::vector<std::size_t>{};
+        if constexpr (detail::batch_range<Rng>) {
+            selection.resize(std::ranges::size(rng));
+            auto count = std::size_t{};
+            detail::for_each_selection<Proj>(std::ranges::data(rng), selection.size(), pred, proj,
+                [&](std::size_t i, std::size_t selected) {
+                    selection[count] = i;
+                    count += selected;
+                }
+            );
+            selection.resize(count);
+        } else {
+            auto i = std::size_t{};
+            for (auto && x : rng) {
+                if (std::invoke(pred, std::invoke(proj, x))) {
+                    selection.push_back(i);
+                }
+                ++i;
+            }
+        }
+        return selection;
+    }
+
+    // Partial applicator and pipe launcher
+    template <typename Pred, typename Proj = identity_fn>
+        requires (not std::ranges::input_range<Pred>)
+    constexpr static auto operator()(Pred pred, Proj proj = {}) noexcept
+    {
+        return predicate_capture<select_fn, Pred, Proj>{std::move(pred), std::move(proj)};
+    }
+};
+
+constexpr inline select_fn select;
+
+/**
+ * @brief moves the elements for which `pred(proj(x))` holds to the front of the range, keeping their
+ *  order, and returns them; the elements past them are left in a valid but unspecified state. Contiguous
+ *  ranges of trivially copyable elements are compacted without branching on the result (see `select`),
+ *  the others as `std::ranges::remove_if` would
+ */
+struct compact_fn
+{
+    template <
+        std::ranges::forward_range Rng, typename Proj = identity_fn,
+        std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<Rng>, Proj>> Pred
+    >
+        requires std::permutable<std::ranges::iterator_t<Rng>>
+    constexpr static auto operator()(Rng && rng, Pred pred, Proj proj = {}) -> std::ranges::borrowed_subrange_t<Rng>
+    {
+        auto const first = std::ranges::begin(rng);
+        if constexpr (detail::batch_range<Rng> and std::is_trivially_copyable_v<std::ranges::range_value_t<Rng>>) {
+            // each element is copied to the end of the compacted ones, which only grows if it is selected;
+            //  the copy of an element onto itself is harmless, as it is trivial
+            auto const data = std::ranges::data(rng);
+            auto count = std::size_t{};
+            detail::for_each_selection<Proj>(data, std::ranges::size(rng), pred, proj,
+                [&](std::size_t i, std::size_t selected) {
+                    data[count] = data[i];
+                    count += selected;
+                }
+            );
+            return {first, std::ranges::next(first, static_cast<std::ranges::range_difference_t<Rng>>(count))};
+        } else {
+            auto last = first;
+            for (auto it = first; it != std::ranges::end(rng); ++it) {
+                if (std::invoke(pred, std::invoke(proj, *it))) {
+                    if (it != last) {
+                        *last = std::ranges::iter_move(it);
+                    }
+                    ++last;
+                }
+            }
+            return {first, last};
+        }
+    }
+
+    // Partial applicator and pipe launcher
+    template <typename Pred, typename Proj = identity_fn>
+        requires (not std::ranges::input_range<Pred>)
+    constexpr static auto operator()(Pred pred, Proj proj = {}) noexcept
+    {
+        return predicate_capture<compact_fn, Pred, Proj>{std::move(pred), std::move(proj)};
+    }
+};
+
+constexpr inline compact_fn compact;
+
+
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
 // ....................................FOLD.................................... //
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
 
 struct fold_fn
 {
-    static constexpr auto use_projection = false;
-
+    /**
+     * @brief folds the projections of [first, last) from the left, starting from `init`: the
+     *  projection is applied in the loop itself, so there is no need for an intermediate view
+     */
     template <
         std::input_iterator I, std::sentinel_for<I> S, typename Init = std::iter_value_t<I>,
         typename BinaryOp, typename Proj = identity_fn
     >
+        requires (not exec::execution_policy<BinaryOp> and not exec::execution_policy<Proj>
+                  and detail::left_foldable<BinaryOp, Init, I, Proj>)
     constexpr static auto operator()(I first, S last, Init init, BinaryOp binary_fn, Proj proj = {}) -> decltype(auto)
     {
-        return std::ranges::fold_left(std::move(first), std::move(last), std::move(init), std::move(binary_fn));
+        if constexpr (_short_circuits<BinaryOp, Init, detail::projected_reference_t<I, Proj>>) {
+            return _fold_logical<BinaryOp>(static_cast<bool>(init), std::move(first), std::move(last), proj);
+        } else {
+            return std::ranges::fold_left(
+                std::move(first), std::move(last), std::move(init), _project(std::move(binary_fn), std::move(proj))
+            );
+        }
     }
 
-    template <std::ranges::input_range Rng, typename Init = std::ranges::range_value_t<Rng>, typename Cb>
-    constexpr static auto operator()(Rng && rng, Init && init, Cb binary_fn) -> decltype(auto)
+    template <
+        std::ranges::input_range Rng, typename Init = std::ranges::range_value_t<Rng>,
+        typename Cb, typename Proj = identity_fn
+    >
+        requires (not exec::execution_policy<Cb> and not exec::execution_policy<Proj>
+                  and detail::left_foldable<Cb, Init, std::ranges::iterator_t<Rng>, Proj>)
+    constexpr static auto operator()(Rng && rng, Init init, Cb binary_fn, Proj proj = {}) -> decltype(auto)
     {
-        return std::ranges::fold_left(CB_FWD(rng), std::move(init), std::move(binary_fn));
+        return operator()(
+            std::ranges::begin(rng), std::ranges::end(rng), std::move(init), std::move(binary_fn), std::move(proj)
+        );
     }
 
-    template <std::input_iterator I, std::sentinel_for<I> S, typename Cb>
-    constexpr static auto operator()(I first, S last, Cb binary_fn) -> decltype(auto)
+    // Without an initial value the fold starts from the first projection, and gives an empty
+    //  optional if the range is empty
+    template <std::input_iterator I, std::sentinel_for<I> S, typename Cb, typename Proj = identity_fn>
+        requires (not exec::execution_policy<Cb> and not exec::execution_policy<Proj>
+                  and detail::left_foldable_first<Cb, I, Proj>)
+    constexpr static auto operator()(I first, S last, Cb binary_fn, Proj proj = {}) -> decltype(auto)
     {
-        return std::ranges::fold_left_first(std::move(first), std::move(last), std::move(binary_fn));
+        using reference_t = detail::projected_reference_t<I, Proj>;
+        using value_t = std::remove_cvref_t<reference_t>;
+        if constexpr (_short_circuits<Cb, value_t, reference_t>) {
+            if (first == last) {
+                return std::optional<bool>{};
+            }
+            auto const init = static_cast<bool>(std::invoke(proj, *first));
+            return std::optional<bool>{
+                _fold_logical<Cb>(init, std::ranges::next(std::move(first)), std::move(last), proj)
+            };
+        } else {
+            using result_t = std::decay_t<std::invoke_result_t<Cb &, value_t, reference_t>>;
+            if (first == last) {
+                return std::optional<result_t>{};
+            }
+            auto init = static_cast<result_t>(std::invoke(proj, *first));
+            return std::optional<result_t>{std::ranges::fold_left(
+                std::ranges::next(std::move(first)), std::move(last), std::move(init),
+                _project(std::move(binary_fn), std::move(proj))
+            )};
+        }
     }
 
-    template <std::ranges::input_range Rng, typename Cb>
-    constexpr static auto operator()(Rng && rng, Cb binary_fn) -> decltype(auto)
+    template <std::ranges::input_range Rng, typename Cb, typename Proj = identity_fn>
+        requires (not exec::execution_policy<Cb> and not exec::execution_policy<Proj>
+                  and detail::left_foldable_first<Cb, std::ranges::iterator_t<Rng>, Proj>)
+    constexpr static auto operator()(Rng && rng, Cb binary_fn, Proj proj = {}) -> decltype(auto)
     {
-        return std::ranges::fold_left_first(CB_FWD(rng), std::move(binary_fn));
+        return operator()(std::ranges::begin(rng), std::ranges::end(rng), std::move(binary_fn), std::move(proj));
     }
 
-    // Partial applicators and "pipe launchers"
-    template <typename Cb, typename Init>
-        requires (not std::ranges::input_range<Cb>)
-    constexpr static auto operator()(Cb binary_fn, Init init) noexcept
+    /**
+     * @brief the same fold, run according to `policy`: if `binary_fn` is associative and the range is
+     *  random access, `exec::par` folds contiguous chunks on different threads and `exec::unseq`
+     *  (provided that `binary_fn` is commutative too) folds on many independent lanes, which the
+     *  compiler can vectorize; the partial results are then folded in order, starting from `init`.
+     *  Otherwise, or during constant evaluation, the fold is sequential
+     */
+    template <
+        std::input_iterator I, std::sentinel_for<I> S, typename Init = std::iter_value_t<I>,
+        typename BinaryOp, typename Proj, exec::execution_policy Policy
+    >
+        requires detail::left_foldable<BinaryOp, Init, I, Proj>
+    constexpr static auto operator()(I first, S last, Init init, BinaryOp binary_fn, Proj proj, Policy policy)
+        -> decltype(auto)
     {
-        if constexpr (std::is_empty_v<std::remove_cvref_t<Cb>>) {
-            return action_capture<fold_fn, Cb, identity_fn, Init>{std::move(init)};
+        if constexpr (_parallelizable<I, S, BinaryOp, Policy>) {
+            if not consteval {
+                using result_t = std::decay_t<std::invoke_result_t<BinaryOp &, Init, detail::projected_reference_t<I, Proj>>>;
+                auto const size = std::ranges::distance(first, last);
+                auto partial = _fold_first<result_t>(std::move(first), size, binary_fn, proj, policy);
+                if (not partial) {
+                    return static_cast<result_t>(std::move(init));
+                }
+                return static_cast<result_t>(std::invoke(binary_fn, std::move(init), *std::move(partial)));
+            }
+        }
+        return operator()(std::move(first), std::move(last), std::move(init), std::move(binary_fn), std::move(proj));
+    }
+
+    template <
+        std::input_iterator I, std::sentinel_for<I> S, typename Init = std::iter_value_t<I>,
+        typename BinaryOp, exec::execution_policy Policy
+    >
+        requires detail::left_foldable<BinaryOp, Init, I, identity_fn>
+    constexpr static auto operator()(I first, S last, Init init, BinaryOp binary_fn, Policy policy) -> decltype(auto)
+    {
+        return operator()(std::move(first), std::move(last), std::move(init), std::move(binary_fn), identity_fn{}, policy);
+    }
+
+    template <std::ranges::input_range Rng, typename Init = std::ranges::range_value_t<Rng>, typename Cb,
+              typename Proj, exec::execution_policy Policy>
+        requires detail::left_foldable<Cb, Init, std::ranges::iterator_t<Rng>, Proj>
+    constexpr static auto operator()(Rng && rng, Init init, Cb binary_fn, Proj proj, Policy policy) -> decltype(auto)
+    {
+        return operator()(
+            std::ranges::begin(rng), std::ranges::end(rng), std::move(init), std::move(binary_fn), std::move(proj), policy
+        );
+    }
+
+    template <std::ranges::input_range Rng, typename Init = std::ranges::range_value_t<Rng>, typename Cb,
+              exec::execution_policy Policy>
+        requires detail::left_foldable<Cb, Init, std::ranges::iterator_t<Rng>, identity_fn>
+    constexpr static auto operator()(Rng && rng, Init init, Cb binary_fn, Policy policy) -> decltype(auto)
+    {
+        return operator()(
+            std::ranges::begin(rng), std::ranges::end(rng), std::move(init), std::move(binary_fn), identity_fn{}, policy
+        );
+    }
+
+    template <std::input_iterator I, std::sentinel_for<I> S, typename Cb, typename Proj, exec::execution_policy Policy>
+        requires detail::left_foldable_first<Cb, I, Proj>
+    constexpr static auto operator()(I first, S last, Cb binary_fn, Proj proj, Policy policy) -> decltype(auto)
+    {
+        if constexpr (_parallelizable<I, S, Cb, Policy>) {
+            if not consteval {
+                using reference_t = detail::projected_reference_t<I, Proj>;
+                using result_t = std::decay_t<std::invoke_result_t<Cb &, std::remove_cvref_t<reference_t>, reference_t>>;
+                return _fold_first<result_t>(first, std::ranges::distance(first, last), binary_fn, proj, policy);
+            }
+        }
+        return operator()(std::move(first), std::move(last), std::move(binary_fn), std::move(proj));
+    }
+
+    template <std::input_iterator I, std::sentinel_for<I> S, typename Cb, exec::execution_policy Policy>
+        requires detail::left_foldable_first<Cb, I, identity_fn>
+    constexpr static auto operator()(I first, S last, Cb binary_fn, Policy policy) -> decltype(auto)
+    {
+        return operator()(std::move(first), std::move(last), std::move(binary_fn), identity_fn{}, policy);
+    }
+
+    template <std::ranges::input_range Rng, typename Cb, typename Proj, exec::execution_policy Policy>
+        requires detail::left_foldable_first<Cb, std::ranges::iterator_t<Rng>, Proj>
+    constexpr static auto operator()(Rng && rng, Cb binary_fn, Proj proj, Policy policy) -> decltype(auto)
+    {
+        return operator()(std::ranges::begin(rng), std::ranges::end(rng), std::move(binary_fn), std::move(proj), policy);
+    }
+
+    template <std::ranges::input_range Rng, typename Cb, exec::execution_policy Policy>
+        requires detail::left_foldable_first<Cb, std::ranges::iterator_t<Rng>, identity_fn>
+    constexpr static auto operator()(Rng && rng, Cb binary_fn, Policy policy) -> decltype(auto)
+    {
+        return operator()(std::ranges::begin(rng), std::ranges::end(rng), std::move(binary_fn), identity_fn{}, policy);
+    }
+
+    // Partial applicators and "pipe launchers"; a projection can be given only together with `init`
+    template <typename Cb, typename Init, typename Proj = identity_fn>
+        requires (not std::ranges::input_range<Cb> and not std::input_or_output_iterator<Cb>
+                  and not exec::execution_policy<Init> and not exec::execution_policy<Proj>)
+    constexpr static auto operator()(Cb binary_fn, Init init, Proj proj = {}) noexcept
+    {
+        if constexpr (std::is_empty_v<std::remove_cvref_t<Cb>> and std::is_empty_v<std::remove_cvref_t<Proj>>) {
+            return action_capture<fold_fn, Cb, Proj, Init>{std::move(init)};
         } else {
-            return action_capture<fold_fn, Cb, identity_fn, Init>{std::move(binary_fn), {}, std::move(init)};
+            return action_capture<fold_fn, Cb, Proj, Init>{std::move(binary_fn), std::move(proj), std::move(init)};
         }
     }
 
@@ -197,6 +636,141 @@ struct fold_fn
             return action_capture<fold_fn, Cb, identity_fn, void>{std::move(binary_fn), {}};
         }
     }
+
+    template <typename Cb, typename Init, typename Proj, exec::execution_policy Policy>
+        requires (not std::ranges::input_range<Cb> and not std::input_or_output_iterator<Cb>)
+    constexpr static auto operator()(Cb binary_fn, Init init, Proj proj, Policy) noexcept
+    {
+        using action = with_policy<fold_fn, Policy>;
+        if constexpr (std::is_empty_v<std::remove_cvref_t<Cb>> and std::is_empty_v<std::remove_cvref_t<Proj>>) {
+            return action_capture<action, Cb, Proj, Init>{std::move(init)};
+        } else {
+            return action_capture<action, Cb, Proj, Init>{std::move(binary_fn), std::move(proj), std::move(init)};
+        }
+    }
+
+    template <typename Cb, typename Init, exec::execution_policy Policy>
+        requires (not std::ranges::input_range<Cb> and not std::input_or_output_iterator<Cb>)
+    constexpr static auto operator()(Cb binary_fn, Init init, Policy policy) noexcept
+    {
+        return operator()(std::move(binary_fn), std::move(init), identity_fn{}, policy);
+    }
+
+    template <typename Cb, exec::execution_policy Policy>
+        requires (not std::ranges::input_range<Cb>)
+    constexpr static auto operator()(Cb binary_fn, Policy) noexcept
+    {
+        using action = with_policy<fold_fn, Policy>;
+        if constexpr (std::is_empty_v<std::remove_cvref_t<Cb>>) {
+            return action_capture<action, Cb, identity_fn, void>{};
+        } else {
+            return action_capture<action, Cb, identity_fn, void>{std::move(binary_fn), {}};
+        }
+    }
+
+private:
+    template <typename Proj>
+    static constexpr auto _is_identity = std::same_as<std::unwrap_reference_t<std::remove_cvref_t<Proj>>, identity_fn>;
+
+    // `binary_fn` applied to the accumulator and to the projection of an element
+    template <typename Cb, typename Proj>
+    struct _projected
+    {
+        [[no_unique_address]] Cb _fn;
+        [[no_unique_address]] Proj _proj;
+
+        template <typename Acc, typename T>
+        constexpr auto operator()(Acc && acc, T && t) const
+            -> std::invoke_result_t<Cb const &, Acc, std::invoke_result_t<Proj const &, T>>
+        {
+            return std::invoke(_fn, CB_FWD(acc), std::invoke(_proj, CB_FWD(t)));
+        }
+    };
+
+    template <typename Cb, typename Proj>
+    static constexpr auto _project(Cb binary_fn, Proj proj)
+    {
+        if constexpr (_is_identity<Proj>) {
+            return binary_fn;
+        } else {
+            return _projected<Cb, Proj>{std::move(binary_fn), std::move(proj)};
+        }
+    }
+
+    // `logical_and` (`logical_or`) folds to false (true) as soon as an element is, so the rest can
+    //  be skipped, as long as the operation gives a plain `bool`
+    template <typename Cb, typename Init, typename Ref>
+    static constexpr auto _short_circuits = []{
+        using op_t = std::unwrap_reference_t<std::remove_cvref_t<Cb>>;
+        if constexpr (std::same_as<op_t, logical_and_fn> or std::same_as<op_t, logical_or_fn>) {
+            return std::same_as<std::invoke_result_t<op_t const &, Init, Ref>, bool>
+               and std::same_as<std::invoke_result_t<op_t const &, bool, Ref>, bool>;
+        } else {
+            return false;
+        }
+    }();
+
+    template <typename Cb, typename I, typename S, typename Proj>
+    static constexpr auto _fold_logical(bool init, I first, S last, Proj & proj) -> bool
+    {
+        auto const truth_of = [&](auto && action) {
+            if constexpr (_is_identity<Proj>) {
+                return action(std::move(first), std::move(last));
+            } else {
+                return action(std::move(first), std::move(last), identity_fn{}, proj);
+            }
+        };
+        if constexpr (std::same_as<std::unwrap_reference_t<std::remove_cvref_t<Cb>>, logical_and_fn>) {
+            return init and truth_of(all_of);
+        } else {
+            return init or truth_of(any_of);
+        }
+    }
+
+    template <typename I, typename S, typename Cb, typename Policy>
+    static constexpr auto _parallelizable = std::random_access_iterator<I> and std::sized_sentinel_for<S, I>
+        and is_associative<std::unwrap_reference_t<std::remove_cvref_t<Cb>>>
+        and not std::same_as<Policy, exec::sequenced_policy>;
+
+    // Folds the projections of the `size` elements from `first` without an initial value, as the
+    //  sequential fold without `init` would, accumulating in `T`: the type of the whole fold, which
+    //  with `init` can be wider than the elements
+    template <typename T, std::random_access_iterator I, typename Cb, typename Proj, typename Policy>
+    static auto _fold_first(I first, std::iter_difference_t<I> size, Cb & binary_fn, Proj & proj, Policy)
+    {
+        using op_t = std::unwrap_reference_t<std::remove_cvref_t<Cb>>;
+        using value_t = std::remove_cvref_t<detail::projected_reference_t<I, Proj>>;
+        constexpr auto lanes = exec::vectorized_policy<Policy> and is_commutative<op_t>
+                               and std::is_arithmetic_v<value_t> ? std::size_t{8} : std::size_t{1};
+
+        if constexpr (not exec::multithreaded_policy<Policy>) {
+            return detail::fold_lanes<lanes, T>(first, size, binary_fn, proj);
+        } else {
+            using partial_t = std::optional<T>;
+            auto const chunks = detail::chunk_count(static_cast<std::size_t>(size), detail::min_elements_per_thread);
+            auto partials = std::vector<partial_t>(chunks);
+            detail::for_each_chunk(static_cast<std::size_t>(size), chunks,
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    using diff_t = std::iter_difference_t<I>;
+                    partials[chunk] = detail::fold_lanes<lanes, T>(
+                        first + static_cast<diff_t>(begin), static_cast<diff_t>(end - begin), binary_fn, proj
+                    );
+                }
+            );
+            auto result = std::move(partials.front());
+            for (auto & partial : partials | std::views::drop(1)) {
+                if (not partial) {
+                    continue;
+                }
+                if (result) {
+                    result = std::invoke(binary_fn, *std::move(result), *std::move(partial));
+                } else {
+                    result = std::move(partial);
+                }
+            }
+            return result;
+        }
+    }
 };
 
 constexpr inline fold_fn fold;
@@ -207,12 +781,34 @@ constexpr inline fold_fn fold;
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
 struct sort_fn
 {
+    /**
+     * @brief sorts [first, last) by `compare` on the projected elements. When `compare` is
+     *  `less_fn` or `greater_fn` and the projected elements are integers or floating points, large
+     *  ranges are radix sorted instead of compared; equal keys then keep their relative order
+     */
     template <
         std::random_access_iterator I, std::sentinel_for<I> S,
         typename Comp = less_fn, typename Proj = identity_fn
     >
+        requires (not exec::execution_policy<Comp> and not exec::execution_policy<Proj>)
     constexpr static auto operator()(I first, S last, Comp compare = {}, Proj projection = {}) -> decltype(auto)
     {
+        if constexpr (_radix_sortable<I, S, Comp, Proj>) {
+            if not consteval {
+                using key_t = std::remove_cvref_t<std::indirect_result_t<Proj &, I>>;
+                auto const size = static_cast<std::size_t>(std::ranges::distance(first, last));
+                if (size >= detail::radix_sort_threshold<sizeof(key_t)>) {
+                    // plain numbers are sorted by themselves, other elements through their positions
+                    if constexpr (_is_identity<Proj> and std::same_as<std::iter_value_t<I>, key_t>) {
+                        detail::radix_sort_values<_descending<Comp>>(first, size);
+                        return first + static_cast<std::iter_difference_t<I>>(size);
+                    } else if (size <= std::numeric_limits<std::uint32_t>::max()
+                               and detail::radix_sort<_descending<Comp>>(first, size, projection)) {
+                        return first + static_cast<std::iter_difference_t<I>>(size);
+                    }
+                }
+            }
+        }
         return std::ranges::sort(std::move(first), std::move(last), std::move(compare), std::move(projection));
     }
 
@@ -220,17 +816,75 @@ struct sort_fn
         std::ranges::random_access_range Rng,
         typename Comp = less_fn, typename Proj = identity_fn
     >
+        requires (not exec::execution_policy<Comp> and not exec::execution_policy<Proj>)
     constexpr static auto operator()(Rng && rng, Comp compare = {}, Proj projection = {}) -> decltype(auto)
     {
         auto && result = CB_FWD(rng);
-        std::ranges::sort(rng, std::move(compare), std::move(projection));
+        operator()(std::ranges::begin(rng), std::ranges::end(rng), std::move(compare), std::move(projection));
         return result;
     }
 
+    /**
+     * @brief the same sort, run according to `policy`: with `exec::par` or `exec::par_unseq`, large
+     *  ranges are split in contiguous chunks which are sorted on different threads and then merged
+     *  pairwise, again in parallel. Otherwise, or during constant evaluation, the sort is sequential
+     */
+    template <
+        std::random_access_iterator I, std::sentinel_for<I> S,
+        typename Comp, typename Proj, exec::execution_policy Policy
+    >
+    constexpr static auto operator()(I first, S last, Comp compare, Proj projection, Policy) -> decltype(auto)
+    {
+        if constexpr (exec::multithreaded_policy<Policy> and std::sized_sentinel_for<S, I>) {
+            if not consteval {
+                auto const size = static_cast<std::size_t>(std::ranges::distance(first, last));
+                auto const chunks = detail::chunk_count(size, detail::min_elements_per_thread);
+                if (chunks > 1) {
+                    _sort_parallel(first, size, chunks, compare, projection);
+                    return first + static_cast<std::iter_difference_t<I>>(size);
+                }
+            }
+        }
+        return operator()(std::move(first), std::move(last), std::move(compare), std::move(projection));
+    }
 
-    // Partial applicator and pipe launcher
+    template <std::random_access_iterator I, std::sentinel_for<I> S, typename Comp, exec::execution_policy Policy>
+    constexpr static auto operator()(I first, S last, Comp compare, Policy policy) -> decltype(auto)
+    {
+        return operator()(std::move(first), std::move(last), std::move(compare), identity_fn{}, policy);
+    }
+
+    template <std::random_access_iterator I, std::sentinel_for<I> S, exec::execution_policy Policy>
+    constexpr static auto operator()(I first, S last, Policy policy) -> decltype(auto)
+    {
+        return operator()(std::move(first), std::move(last), less_fn{}, identity_fn{}, policy);
+    }
+
+    template <std::ranges::random_access_range Rng, typename Comp, typename Proj, exec::execution_policy Policy>
+    constexpr static auto operator()(Rng && rng, Comp compare, Proj projection, Policy policy) -> decltype(auto)
+    {
+        auto && result = CB_FWD(rng);
+        operator()(std::ranges::begin(rng), std::ranges::end(rng), std::move(compare), std::move(projection), policy);
+        return result;
+    }
+
+    template <std::ranges::random_access_range Rng, typename Comp, exec::execution_policy Policy>
+    constexpr static auto operator()(Rng && rng, Comp compare, Policy policy) -> decltype(auto)
+    {
+        return operator()(CB_FWD(rng), std::move(compare), identity_fn{}, policy);
+    }
+
+    template <std::ranges::random_access_range Rng, exec::execution_policy Policy>
+    constexpr static auto operator()(Rng && rng, Policy policy) -> decltype(auto)
+    {
+        return operator()(CB_FWD(rng), less_fn{}, identity_fn{}, policy);
+    }
+
+
+    // Partial applicators and pipe launchers
     template <typename Comp = less_fn, typename Proj = identity_fn>
-        requires (not std::ranges::input_range<Comp>)
+        requires (not std::ranges::input_range<Comp>
+                  and not exec::execution_policy<Comp> and not exec::execution_policy<Proj>)
     constexpr static auto operator()(Comp compare = {}, Proj projection = {}) noexcept
     {
         if constexpr (std::is_empty_v<std::remove_cvref_t<Comp>> and std::is_empty_v<std::remove_cvref_t<Proj>>) {
@@ -239,6 +893,84 @@ struct sort_fn
             return action_capture<sort_fn, Comp, Proj, void>{std::move(compare), std::move(projection)};
         }
     }
+
+    template <typename Comp, typename Proj, exec::execution_policy Policy>
+        requires (not std::ranges::input_range<Comp> and not std::input_or_output_iterator<Comp>)
+    constexpr static auto operator()(Comp compare, Proj projection, Policy) noexcept
+    {
+        using action = with_policy<sort_fn, Policy>;
+        if constexpr (std::is_empty_v<std::remove_cvref_t<Comp>> and std::is_empty_v<std::remove_cvref_t<Proj>>) {
+            return action_capture<action, Comp, Proj, void>{};
+        } else {
+            return action_capture<action, Comp, Proj, void>{std::move(compare), std::move(projection)};
+        }
+    }
+
+    template <typename Comp, exec::execution_policy Policy>
+        requires (not std::ranges::input_range<Comp>)
+    constexpr static auto operator()(Comp compare, Policy policy) noexcept
+    {
+        return operator()(std::move(compare), identity_fn{}, policy);
+    }
+
+    template <exec::execution_policy Policy>
+    constexpr static auto operator()(Policy policy) noexcept
+    {
+        return operator()(less_fn{}, identity_fn{}, policy);
+    }
+
+    // `sort.par(args...)` is `sort(args..., exec::par)`
+    struct par_fn
+    {
+        template <typename ...Args>
+        constexpr static auto operator()(Args &&... args) -> decltype(auto)
+        {
+            return sort_fn{}(CB_FWD(args)..., exec::par);
+        }
+    };
+
+    static constexpr par_fn par{};
+
+private:
+    template <typename Comp>
+    using _comparator_t = std::unwrap_reference_t<std::remove_cvref_t<Comp>>;
+
+    template <typename Proj>
+    static constexpr auto _is_identity = std::same_as<std::unwrap_reference_t<std::remove_cvref_t<Proj>>, identity_fn>;
+
+    template <typename Comp>
+    static constexpr auto _descending = std::same_as<_comparator_t<Comp>, greater_fn>;
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    static constexpr auto _radix_sortable = std::sized_sentinel_for<S, I>
+        and (std::same_as<_comparator_t<Comp>, less_fn> or std::same_as<_comparator_t<Comp>, greater_fn>)
+        and detail::radix_key<std::remove_cvref_t<std::indirect_result_t<Proj &, I>>>;
+
+    // Sorts `chunks` contiguous chunks of the `size` elements from `first` on different threads,
+    //  then merges neighbouring sorted runs, doubling their width at each round
+    template <std::random_access_iterator I, typename Comp, typename Proj>
+    static auto _sort_parallel(I first, std::size_t size, std::size_t chunks, Comp & compare, Proj & projection)
+        -> void
+    {
+        auto const at = [&](std::size_t chunk) {
+            return first + static_cast<std::iter_difference_t<I>>(detail::chunk_begin(size, chunks, chunk));
+        };
+        detail::for_each_chunk(size, chunks, [&](std::size_t chunk, std::size_t, std::size_t) {
+            sort_fn{}(at(chunk), at(chunk + 1), compare, projection);
+        });
+        for (auto width = std::size_t{1}; width < chunks; width *= 2) {
+            auto const merges = (chunks + 2 * width - 1) / (2 * width);
+            // one merge per "chunk" of [0, merges)
+            detail::for_each_chunk(merges, merges, [&](std::size_t merge, std::size_t, std::size_t) {
+                auto const low = merge * 2 * width;
+                auto const middle = std::min(low + width, chunks);
+                auto const high = std::min(low + 2 * width, chunks);
+                if (middle < high) {
+                    std::ranges::inplace_merge(at(low), at(middle), at(high), compare, projection);
+                }
+            });
+        }
+    }
 };
 
 constexpr inline sort_fn sort;
@@ -31,6 +31,7 @@
 #ifndef CB_ARITHMETIC_HPP
 #define CB_ARITHMETIC_HPP
 
+#include "detail/divisor.hpp"
 #include "detail/partial.hpp"
 #include "detail/_config_begin.hpp"
 
@@ -41,6 +42,7 @@ namespace callables
 // minus
 // multiplies
 // divides
+// modulus
 // negate
 
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
@@ -106,11 +108,58 @@ struct divides_fn : public binary_fn<divides_fn>, applicable_on_tuples<divides_f
         -> decltype(auto)
     { return CB_FWD(t) / CB_FWD(u); }
 
+    template <typename T, typename D>
+        requires requires(T && t, detail::divisor<D> const & d) { d.quotient(CB_FWD(t)); }
+    constexpr CB_STATIC
+    auto operator()(T && t, detail::divisor<D> const & d) CB_CONST noexcept(noexcept(d.quotient(CB_FWD(t))))
+        -> decltype(auto)
+    { return d.quotient(CB_FWD(t)); }
+
+    // an integer divisor bound on the right is prepared once, so that each division is a multiplication
+    template <typename T>
+        requires detail::reducible_divisor<std::remove_cvref_t<T>>
+    [[nodiscard]] constexpr
+    static auto right(T && t) noexcept
+    { return right_partial<divides_fn, detail::divisor<std::remove_cvref_t<T>>>{t}; }
+
+    using binary_fn<divides_fn>::right;
     using binary_fn<divides_fn>::operator();
 };
 
 constexpr inline divides_fn divides;
 
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..................................MODULUS................................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+struct modulus_fn : public binary_fn<modulus_fn>, applicable_on_tuples<modulus_fn>
+{
+    template <typename T, typename U>
+        requires requires(T && t, U && u) { CB_FWD(t) % CB_FWD(u); }
+    constexpr CB_STATIC
+    auto operator()(T && t, U && u) CB_CONST noexcept(noexcept(CB_FWD(t) % CB_FWD(u)))
+        -> decltype(auto)
+    { return CB_FWD(t) % CB_FWD(u); }
+
+    template <typename T, typename D>
+        requires requires(T && t, detail::divisor<D> const & d) { d.remainder(CB_FWD(t)); }
+    constexpr CB_STATIC
+    auto operator()(T && t, detail::divisor<D> const & d) CB_CONST noexcept(noexcept(d.remainder(CB_FWD(t))))
+        -> decltype(auto)
+    { return d.remainder(CB_FWD(t)); }
+
+    // an integer divisor bound on the right is prepared once, so that each remainder is a multiplication
+    template <typename T>
+        requires detail::reducible_divisor<std::remove_cvref_t<T>>
+    [[nodiscard]] constexpr
+    static auto right(T && t) noexcept
+    { return right_partial<modulus_fn, detail::divisor<std::remove_cvref_t<T>>>{t}; }
+
+    using binary_fn<modulus_fn>::right;
+    using binary_fn<modulus_fn>::operator();
+};
+
+constexpr inline modulus_fn modulus;
+
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
 // ...................................NEGATE................................... //
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <tuple>
+#include "traits.hpp"
 #include "detail/partial.hpp"
 #include "detail/functional.hpp"
 
@@ -26,49 +27,133 @@ namespace callables
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
 struct composed_tag {};
 
+namespace detail
+{
+// one base per function instead of a `std::tuple`, so that a composition of stateless functions is
+//  empty and a composition of trivially copyable functions is trivially copyable
+template <std::size_t Idx, typename Fn>
+struct composed_leaf {
+    [[no_unique_address]] Fn fn;
+};
+
+template <typename Idxs, typename ...Fns> struct composed_storage;
+
+template <std::size_t ...Idxs, typename ...Fns>
+struct composed_storage<std::index_sequence<Idxs...>, Fns...> : composed_leaf<Idxs, Fns>... {};
+
+// the result of a stage of the pipeline: references are passed through, values are materialized
+//  once and moved into the next stage
+template <typename T>
+struct composed_result {
+    T value;
+};
+
+template <typename Fn>
+struct composed_stage {
+    Fn && fn;
+};
+
+template <typename T, typename Fn>
+constexpr auto operator->*(composed_result<T> && result, composed_stage<Fn> stage)
+    -> composed_result<std::invoke_result_t<Fn, T>>
+{
+    return {CB_FWD(stage.fn)(static_cast<T &&>(result.value))};
+}
+}  // namespace detail
+
 template <typename ...Fns>
 class composed : public composed_tag {
     static constexpr auto size = sizeof...(Fns);
-    std::tuple<Fns...> _functions;
+    [[no_unique_address]] detail::composed_storage<std::index_sequence_for<Fns...>, Fns...> _functions;
 
-    template <int64_t Idx, typename Tuple, typename ...Args>
-    static constexpr auto step(Tuple && functions, Args &&... args) -> decltype(auto) {
-        if constexpr (Idx == size - 1) {
-            return std::get<Idx>(CB_FWD(functions))(CB_FWD(args)...);
-        } else {
-            return std::get<Idx>(CB_FWD(functions))(step<Idx + 1>(CB_FWD(functions), CB_FWD(args)...));
-        }
+    template <std::size_t Idx, typename Fn>
+    static auto _leaf(detail::composed_leaf<Idx, Fn> const &) -> detail::composed_leaf<Idx, Fn>;
+
+    template <std::size_t Idx, typename Self>
+    static constexpr auto _get(Self && self) -> auto && {
+        using leaf = decltype(_leaf<Idx>(self._functions));
+        return std::forward_like<Self>(self._functions.leaf::fn);
+    }
+
+    // the functions are applied by a single fold, from the last to the second one, instead of
+    //  recursing once per function; the first one is called directly, so its result is not moved.
+    //  It is returned by value: a reference into the intermediate results would dangle
+    template <typename Self, std::size_t ...Idxs, typename ...Args>
+    static constexpr auto _call(Self && self, std::index_sequence<Idxs...>, Args &&... args) {
+        using last = decltype(_get<size - 1>(CB_FWD(self)));
+        using result = detail::composed_result<std::invoke_result_t<last, Args...>>;
+        return _get<0>(CB_FWD(self))(_value((
+            result{_get<size - 1>(CB_FWD(self))(CB_FWD(args)...)}
+                ->* ... ->* _stage<size - 2 - Idxs>(CB_FWD(self))
+        )));
+    }
+
+    template <std::size_t Idx, typename Self>
+    static constexpr auto _stage(Self && self) {
+        return detail::composed_stage<decltype(_get<Idx>(CB_FWD(self)))>{_get<Idx>(CB_FWD(self))};
+    }
+
+    template <typename T>
+    static constexpr auto _value(detail::composed_result<T> && result) -> T && {
+        return static_cast<T &&>(result.value);
+    }
+
+    template <typename Self>
+    constexpr auto _references(this Self && self) {
+        return [&]<std::size_t ...Idxs>(std::index_sequence<Idxs...>) {
+            return std::forward_as_tuple(_get<Idxs>(CB_FWD(self))...);
+        }(std::index_sequence_for<Fns...>{});
     }
 
 public:
     friend class compose_fn;
 
-    template <typename Self, typename ...Args>
+    // the arguments only reach the last function, so they can be swapped if it is commutative
+    static constexpr auto is_commutative = [] {
+        if constexpr (size == 0) {
+            return false;
+        } else {
+            return callables::is_commutative<std::remove_cvref_t<std::tuple_element_t<size - 1, std::tuple<Fns...>>>>;
+        }
+    }();
+
+    template <typename Self, typename ...Args> requires (size > 0)
     constexpr auto operator()(this Self && self, Args &&... args) {
-        return self.template step<0>(std::forward_like<Self>(self._functions), CB_FWD(args)...);
+        if constexpr (size == 1) {
+            return _get<0>(CB_FWD(self))(CB_FWD(args)...);
+        } else {
+            return _call(CB_FWD(self), std::make_index_sequence<size - 2>{}, CB_FWD(args)...);
+        }
     }
 
-    constexpr composed(std::tuple<Fns...> fns) : _functions(std::move(fns)) {}
+    // a single `composed` is copied or moved, not wrapped into a function that can be built from anything
+    template <typename ...Args>
+        requires (sizeof...(Args) == size) and (std::constructible_from<Fns, Args> and ...)
+             and (not (sizeof...(Args) == 1 and (std::same_as<std::remove_cvref_t<Args>, composed> and ...)))
+    constexpr explicit composed(Args &&... fns) : _functions{{CB_FWD(fns)}...} {}
 };
 
 
 struct compose_fn
 {
     template <typename T>
-    static constexpr auto as_tuple(T && arg) { return std::tuple<std::decay_t<T>>{CB_FWD(arg)}; }
+    static constexpr auto as_tuple(T && arg) { return std::forward_as_tuple(CB_FWD(arg)); }
     template <typename Composed> requires std::derived_from<std::remove_cvref_t<Composed>, composed_tag>
-    static constexpr auto as_tuple(Composed && arg) { return CB_FWD(arg)._functions; }
+    static constexpr auto as_tuple(Composed && arg) { return CB_FWD(arg)._references(); }
 
+    // nested compositions are flattened; the functions are only copied once, into the result
     template <typename ...Fns>
         requires (std::derived_from<std::remove_cvref_t<Fns>, composed_tag> or ...)
     constexpr static auto operator()(Fns &&... fns) {
-        return composed{std::tuple_cat(as_tuple(CB_FWD(fns))...)};
+        return std::apply([]<typename ...Ts>(Ts &&... flat) {
+            return composed<std::decay_t<Ts>...>{CB_FWD(flat)...};
+        }, std::tuple_cat(as_tuple(CB_FWD(fns))...));
     }
 
     template <typename ...Fns>
         requires (not std::derived_from<std::remove_cvref_t<Fns>, composed_tag> and ...)
     constexpr static auto operator()(Fns &&... fns) {
-        return composed{std::make_tuple(CB_FWD(fns)...)};
+        return composed<std::decay_t<Fns>...>{CB_FWD(fns)...};
     }
 };
 
@@ -102,6 +187,9 @@ struct on_fn
         [[no_unique_address]] UnaryFn _un;
         [[no_unique_address]] BinaryFn _bin;
 
+        // `_un` is applied to both arguments alike; associativity would also need `_un` to preserve `_bin`
+        static constexpr auto is_commutative = callables::is_commutative<BinaryFn>;
+
         template <typename T, typename U>
             requires requires(T && t, U && u) {
                 { _un(t) };
@@ -199,9 +287,13 @@ struct flip_fn
         }(std::make_index_sequence<sizeof...(Args)>{});
     }
 
+    // `op(b, a)` keeps the associativity, commutativity and identity of `op(a, b)`
     template <typename Fn>
     struct capture
     {
+        static constexpr auto is_associative = callables::is_associative<std::remove_cvref_t<Fn>>;
+        static constexpr auto is_commutative = callables::is_commutative<std::remove_cvref_t<Fn>>;
+
         [[no_unique_address]] Fn _fn;
 
         template <typename ...Args>
@@ -214,6 +306,9 @@ struct flip_fn
         requires std::is_empty_v<Fn>
     struct capture<Fn>
     {
+        static constexpr auto is_associative = callables::is_associative<std::remove_cvref_t<Fn>>;
+        static constexpr auto is_commutative = callables::is_commutative<std::remove_cvref_t<Fn>>;
+
         template <typename ...Args>
         constexpr CB_STATIC auto operator()(Args &&... args) CB_CONST {
             return flip_fn{}(Fn{}, CB_FWD(args)...);
@@ -234,6 +329,9 @@ struct flip_fn
 
 constexpr inline flip_fn flip;
 
+template <typename Fn, typename T>
+struct monoid_traits<flip_fn::capture<Fn>, T> : monoid_traits<std::remove_cvref_t<Fn>, T> {};
+
 static_assert(flip([](auto a, auto b) { return b; })(0, 1) == 0);
 static_assert(flip([](auto a, auto b, auto c) { return c; })(0, 1, 2) == 0);
 
@@ -0,0 +1,148 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Sunday Oct 18, 2026 00:41:19 CEST
+ * @description : division by an invariant integer with a multiplication and shifts, used by `divides` and `modulus`
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_DETAIL_DIVISOR_HPP
+#define CB_DETAIL_DIVISOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "_config_begin.hpp"
+
+namespace callables::detail
+{
+
+// The integers twice as wide as a `Bytes` bytes long one, to hold the product of two of them
+template <std::size_t Bytes> struct double_width;
+
+template <> struct double_width<4> {
+    using type = std::uint64_t;
+    using signed_type = std::int64_t;
+};
+
+#if defined __SIZEOF_INT128__
+template <> struct double_width<8> {
+    __extension__ typedef unsigned __int128 type;
+    __extension__ typedef __int128 signed_type;
+};
+#endif
+
+// Integers that `divisor` divides with a multiplication: 32 bits long ones, and 64 bits long ones if the
+//  compiler has 128 bits long integers
+template <typename T>
+concept reducible_divisor = std::integral<T> and not std::same_as<T, bool>
+    and requires { typename double_width<sizeof(T)>::type; };
+
+// `x / d` and `x % d` for a `d` known only at runtime, but invariant over many `x`s: the magic number is
+//  computed once, so that each division takes a multiplication and some shifts instead of a (much slower)
+//  hardware division. See T. Granlund and P. L. Montgomery, "Division by invariant integers using
+//  multiplication", figures 4.1 (unsigned) and 5.2 (signed). A zero `d` has no magic number: it's only stored,
+//  and the divisions by it are plain ones, as they would be without `divisor`
+template <reducible_divisor T>
+class divisor
+{
+    using unsigned_t = std::make_unsigned_t<T>;
+    using wide_t = typename double_width<sizeof(T)>::type;
+    using signed_wide_t = typename double_width<sizeof(T)>::signed_type;
+    static constexpr auto bits = std::numeric_limits<unsigned_t>::digits;
+
+    T _d;
+    T _magic;
+    std::uint8_t _pre_shift = 0;
+    std::uint8_t _post_shift;
+
+public:
+    constexpr explicit divisor(T d) noexcept : _d{d}, _magic{}, _post_shift{}
+    {
+        if (d == 0) {
+            return;
+        }
+        if constexpr (std::is_unsigned_v<T>) {
+            auto const log = static_cast<int>(std::bit_width(static_cast<unsigned_t>(d - 1)));  // ceil(log2(d))
+            _magic = static_cast<T>((((wide_t{1} << log) - d) << bits) / d + 1);
+            _pre_shift = static_cast<std::uint8_t>(std::min(log, 1));
+            _post_shift = static_cast<std::uint8_t>(std::max(log, 1) - 1);
+        } else {
+            auto const abs = d < 0 ? static_cast<unsigned_t>(unsigned_t{} - static_cast<unsigned_t>(d))
+                                   : static_cast<unsigned_t>(d);
+            auto const log = std::max(static_cast<int>(std::bit_width(static_cast<unsigned_t>(abs - 1))), 1);
+            // 2^bits less than the actual multiplier, which takes bits + 1 bits
+            _magic = static_cast<T>(static_cast<unsigned_t>((wide_t{1} << (bits + log - 1)) / abs + 1));
+            _post_shift = static_cast<std::uint8_t>(log - 1);
+        }
+    }
+
+    [[nodiscard]] constexpr auto value() const noexcept -> T { return _d; }
+
+    // integers of other types are divided as they would be by `d`
+    template <typename U>
+        requires requires(U && x, T d) { CB_FWD(x) / d; }
+    [[nodiscard]] constexpr auto quotient(U && x) const noexcept(noexcept(CB_FWD(x) / _d)) -> decltype(auto)
+    {
+        if constexpr (not std::same_as<std::remove_cvref_t<U>, T>) {
+            return CB_FWD(x) / _d;
+        } else if (_d == 0) [[unlikely]] {
+            return static_cast<T>(x / _d);
+        } else if constexpr (std::is_unsigned_v<T>) {
+            auto const high = static_cast<T>((wide_t{_magic} * x) >> bits);
+            return static_cast<T>((high + ((x - high) >> _pre_shift)) >> _post_shift);
+        } else {
+            // the multiplier is `_magic + 2^bits`, hence the addition of `x`; the sums wrap around as in the
+            //  paper (e.g. with `d == 1` and the minimum `x`), so they are computed on unsigned integers
+            auto const high = static_cast<T>((signed_wide_t{_magic} * x) >> bits);
+            auto const sum = static_cast<T>(static_cast<unsigned_t>(x) + static_cast<unsigned_t>(high));
+            auto const sign = static_cast<unsigned_t>(_d >> (bits - 1));
+            auto const quotient = static_cast<unsigned_t>(sum >> _post_shift) - static_cast<unsigned_t>(x >> (bits - 1));
+            return static_cast<T>((quotient ^ sign) - sign);
+        }
+    }
+
+    template <typename U>
+        requires requires(U && x, T d) { CB_FWD(x) % d; }
+    [[nodiscard]] constexpr auto remainder(U && x) const noexcept(noexcept(CB_FWD(x) % _d)) -> decltype(auto)
+    {
+        if constexpr (not std::same_as<std::remove_cvref_t<U>, T>) {
+            return CB_FWD(x) % _d;
+        } else if (_d == 0) [[unlikely]] {
+            return static_cast<T>(x % _d);
+        } else {
+            return static_cast<T>(static_cast<unsigned_t>(x) - static_cast<unsigned_t>(quotient(x) * _d));
+        }
+    }
+};
+
+}  // namespace callables::detail
+
+#include "_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_DETAIL_DIVISOR_HPP */
@@ -0,0 +1,330 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 10:12:40 CEST
+ * @description : compile-time splitting of format strings, used by `format<Fmt>.compiled`
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_DETAIL_FORMAT_STRING_HPP
+#define CB_DETAIL_FORMAT_STRING_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "functional.hpp"
+#include "_config_begin.hpp"
+
+namespace callables::detail
+{
+
+// A literal chunk or a replacement field of a format string
+struct format_segment
+{
+    static constexpr auto literal = static_cast<std::size_t>(-1);
+
+    std::size_t arg = literal;  // index of the argument to format, or `literal`
+    std::size_t begin = 0;      // the literal text, or the format spec after ':', within the format string
+    std::size_t size = 0;
+};
+
+// Splits `fmt` in segments, storing them in `segments` unless it is null; returns how many
+//  they are, or nothing if the string uses nested replacement fields (e.g. dynamic widths)
+constexpr auto split_format_string(std::string_view fmt, format_segment * segments) -> std::optional<std::size_t>
+{
+    auto count = std::size_t{};
+    auto const push = [&](format_segment segment) {
+        if (segment.arg == format_segment::literal and segment.size == 0) {
+            return;
+        }
+        if (segments != nullptr) {
+            segments[count] = segment;
+        }
+        ++count;
+    };
+    auto const is_digit = [](char ch) { return ch >= '0' and ch <= '9'; };
+
+    auto next_arg = std::size_t{};
+    auto automatic_indexing = false;
+    auto manual_indexing = false;
+    auto literal_begin = std::size_t{};
+    auto i = std::size_t{};
+    while (i < fmt.size()) {
+        if (fmt[i] == '}') {
+            if (i + 1 == fmt.size() or fmt[i + 1] != '}') {
+                throw "unmatched '}' in format string";
+            }
+            push({format_segment::literal, literal_begin, i + 1 - literal_begin});
+            literal_begin = i += 2;
+            continue;
+        }
+        if (fmt[i] != '{') {
+            ++i;
+            continue;
+        }
+        if (i + 1 < fmt.size() and fmt[i + 1] == '{') {
+            push({format_segment::literal, literal_begin, i + 1 - literal_begin});
+            literal_begin = i += 2;
+            continue;
+        }
+
+        push({format_segment::literal, literal_begin, i - literal_begin});
+        ++i;
+        auto field = format_segment{};
+        if (i < fmt.size() and is_digit(fmt[i])) {
+            manual_indexing = true;
+            field.arg = 0;
+            for (; i < fmt.size() and is_digit(fmt[i]); ++i) {
+                field.arg = field.arg * 10 + static_cast<std::size_t>(fmt[i] - '0');
+            }
+        } else {
+            automatic_indexing = true;
+            field.arg = next_arg++;
+        }
+        if (i < fmt.size() and fmt[i] == ':') {
+            field.begin = ++i;
+            for (; i < fmt.size() and fmt[i] != '}'; ++i) {
+                if (fmt[i] == '{') {
+                    return std::nullopt;
+                }
+            }
+            field.size = i - field.begin;
+        }
+        if (i == fmt.size() or fmt[i] != '}') {
+            throw "invalid replacement field in format string";
+        }
+        push(field);
+        literal_begin = ++i;
+    }
+    push({format_segment::literal, literal_begin, fmt.size() - literal_begin});
+
+    if (automatic_indexing and manual_indexing) {
+        throw "cannot mix automatic and manual argument indexing";
+    }
+    return count;
+}
+
+template <auto Fmt>
+struct compiled_format_string
+{
+    static constexpr auto view = std::string_view{Fmt};
+    static constexpr auto count = split_format_string(view, nullptr);
+    // false if the string must be left to `std::format`
+    static constexpr auto supported = count.has_value();
+
+    static constexpr auto segments = [] {
+        auto result = std::array<format_segment, count.value_or(0)>{};
+        if constexpr (supported) {
+            split_format_string(view, result.data());
+        }
+        return result;
+    }();
+
+    static constexpr auto arguments = [] {
+        auto result = std::size_t{};
+        for (auto const & segment : segments) {
+            if (segment.arg != format_segment::literal) {
+                result = std::max(result, segment.arg + 1);
+            }
+        }
+        return result;
+    }();
+
+    // the spec of the field at `Idx` up to its closing '}', for its formatter to parse it
+    template <std::size_t Idx>
+    static constexpr auto field_spec = segments[Idx].size == 0
+        ? std::string_view{"}"}
+        : view.substr(segments[Idx].begin, segments[Idx].size + 1);
+};
+
+// Types that `write_plain` writes exactly as `std::format("{}", t)` would
+template <typename T>
+concept plainly_formattable = std::same_as<T, bool> or std::same_as<T, char>
+    or std::same_as<T, signed char> or std::same_as<T, unsigned char>
+    or (std::integral<T> and not character<T> and not std::same_as<T, char16_t> and not std::same_as<T, char32_t>)
+    or std::floating_point<T>
+    or std::convertible_to<T const &, std::string_view>;
+
+// The longest output of `write_plain` for `T`, or 0 if it has no bound (strings)
+template <plainly_formattable T>
+inline constexpr auto max_plain_length = [] {
+    if constexpr (std::same_as<T, bool>) {
+        return std::size_t{5};
+    } else if constexpr (std::same_as<T, char>) {
+        return std::size_t{1};
+    } else if constexpr (std::integral<T>) {
+        return static_cast<std::size_t>(std::numeric_limits<T>::digits10 + 2);
+    } else if constexpr (std::floating_point<T>) {
+        // the shortest representation is never longer than the scientific one, "-d.ddde-xx"; denormals
+        //  reach at most `max_digits10` decades below `min_exponent10`
+        using limits = std::numeric_limits<T>;
+        auto exponent_digits = std::size_t{};
+        for (auto exponent = limits::max_digits10 - limits::min_exponent10; exponent > 0; exponent /= 10) {
+            ++exponent_digits;
+        }
+        return static_cast<std::size_t>(limits::max_digits10) + 4 + exponent_digits;
+    } else {
+        return std::size_t{0};
+    }
+}();
+
+// Sinks appending to a string or to an output iterator
+struct string_sink
+{
+    std::string & str;
+
+    constexpr auto append(char const * data, std::size_t size) -> void { str.append(data, size); }
+    [[nodiscard]] constexpr auto iterator() const { return std::back_inserter(str); }
+    constexpr auto advance(std::back_insert_iterator<std::string>) noexcept -> void {}
+};
+
+template <typename Out>
+struct iterator_sink
+{
+    Out out;
+
+    constexpr auto append(char const * data, std::size_t size) -> void
+    { out = std::ranges::copy(data, data + size, std::move(out)).out; }
+    [[nodiscard]] constexpr auto iterator() && { return std::move(out); }
+    constexpr auto advance(Out it) -> void { out = std::move(it); }
+};
+
+// Appends to a caller-provided buffer, dropping what does not fit
+struct buffer_sink
+{
+    char * first;
+    char * last;
+    std::size_t written = 0;
+
+    constexpr auto append(char const * data, std::size_t size) noexcept -> void
+    {
+        auto const count = std::min(size, static_cast<std::size_t>(last - first));
+        first = std::copy_n(data, count, first);
+        written += count;
+    }
+};
+
+// "00", "01", ..., "99", to write integers two digits at a time
+inline constexpr auto digit_pairs = [] {
+    auto result = std::array<char, 200>{};
+    for (auto i = 0; i < 100; ++i) {
+        result[2 * i] = static_cast<char>('0' + i / 10);
+        result[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return result;
+}();
+
+// Writes `value` in base 10 backwards from `end`, which must have room for
+//  `digits10 + 2` characters before it; returns the first written character
+template <std::integral T>
+constexpr auto write_integer_backwards(char * end, T value) noexcept -> char *
+{
+    using unsigned_t = std::make_unsigned_t<T>;
+    auto const negative = value < T{};
+    auto rest = negative ? static_cast<unsigned_t>(unsigned_t{} - static_cast<unsigned_t>(value))
+                         : static_cast<unsigned_t>(value);
+    while (rest >= 100) {
+        auto const pair = static_cast<std::size_t>(rest % 100) * 2;
+        rest = static_cast<unsigned_t>(rest / 100);
+        *--end = digit_pairs[pair + 1];
+        *--end = digit_pairs[pair];
+    }
+    if (rest >= 10) {
+        *--end = digit_pairs[static_cast<std::size_t>(rest) * 2 + 1];
+        *--end = digit_pairs[static_cast<std::size_t>(rest) * 2];
+    } else {
+        *--end = static_cast<char>('0' + rest);
+    }
+    if (negative) {
+        *--end = '-';
+    }
+    return end;
+}
+
+template <typename Sink, plainly_formattable T>
+constexpr auto write_plain(Sink & sink, T const & value) -> void
+{
+    if constexpr (std::same_as<T, bool>) {
+        value ? sink.append("true", 4) : sink.append("false", 5);
+    } else if constexpr (std::same_as<T, char>) {
+        sink.append(&value, 1);
+    } else if constexpr (std::integral<T>) {
+        char buffer[std::numeric_limits<T>::digits10 + 2];
+        auto const begin = write_integer_backwards(std::end(buffer), value);
+        sink.append(begin, static_cast<std::size_t>(std::end(buffer) - begin));
+    } else if constexpr (std::floating_point<T>) {
+        // `to_chars` without a precision already gives the shortest round-trip representation
+        char buffer[64];
+        auto const end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+        sink.append(buffer, static_cast<std::size_t>(end - buffer));
+    } else {
+        auto const str = std::string_view{value};
+        sink.append(str.data(), str.size());
+    }
+}
+
+// Writes the arguments as `std::format(Fmt, args...)` would: literal chunks are copied with a
+//  size known at compile time, plain fields are converted directly and the others are given to
+//  `fallback(sink, std::integral_constant<std::size_t, Idx>{}, arg)`, `Idx` being the field segment
+template <auto Fmt, typename Sink, typename Fallback, typename ...Ts>
+constexpr auto write_compiled(Sink & sink, Fallback && fallback, Ts const &... args) -> void
+{
+    using parsed = compiled_format_string<Fmt>;
+    static_assert(parsed::supported);
+    static_assert(sizeof...(Ts) >= parsed::arguments, "not enough arguments for the format string");
+
+    auto const arguments = std::forward_as_tuple(args...);
+    [&]<std::size_t ...Idx>(std::index_sequence<Idx...>) {
+        ([&] {
+            constexpr auto segment = parsed::segments[Idx];
+            if constexpr (segment.arg == format_segment::literal) {
+                sink.append(parsed::view.data() + segment.begin, segment.size);
+            } else {
+                auto const & arg = std::get<segment.arg>(arguments);
+                using arg_t = std::remove_cvref_t<decltype(arg)>;
+                if constexpr (segment.size == 0 and plainly_formattable<arg_t>) {
+                    write_plain(sink, arg);
+                } else {
+                    fallback(sink, std::integral_constant<std::size_t, Idx>{}, arg);
+                }
+            }
+        }(), ...);
+    }(std::make_index_sequence<parsed::segments.size()>{});
+}
+
+}  // namespace callables::detail
+
+#include "_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_DETAIL_FORMAT_STRING_HPP */
@@ -0,0 +1,204 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 17:02:13 CEST
+ * @description : execution policies and the thread/lane splitting used by the parallel and vectorized algorithms
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_DETAIL_PARALLEL_HPP
+#define CB_DETAIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "_config_begin.hpp"
+
+namespace callables
+{
+namespace exec
+{
+// Tags asking an algorithm to run sequentially, on many threads and/or on many SIMD lanes; like the
+//  standard ones they are a permission, not an obligation, and the algorithms may ignore them
+struct sequenced_policy {};
+struct parallel_policy {};
+struct parallel_unsequenced_policy {};
+struct unsequenced_policy {};
+
+constexpr inline sequenced_policy seq;
+constexpr inline parallel_policy par;
+constexpr inline parallel_unsequenced_policy par_unseq;
+constexpr inline unsequenced_policy unseq;
+
+template <typename T>
+concept execution_policy = std::same_as<std::remove_cvref_t<T>, sequenced_policy>
+                        or std::same_as<std::remove_cvref_t<T>, parallel_policy>
+                        or std::same_as<std::remove_cvref_t<T>, parallel_unsequenced_policy>
+                        or std::same_as<std::remove_cvref_t<T>, unsequenced_policy>;
+
+template <typename T>
+concept multithreaded_policy = std::same_as<std::remove_cvref_t<T>, parallel_policy>
+                            or std::same_as<std::remove_cvref_t<T>, parallel_unsequenced_policy>;
+
+template <typename T>
+concept vectorized_policy = std::same_as<std::remove_cvref_t<T>, parallel_unsequenced_policy>
+                         or std::same_as<std::remove_cvref_t<T>, unsequenced_policy>;
+}  // namespace exec
+
+namespace detail
+{
+// Below this many elements per thread, starting a thread costs more than it saves
+constexpr inline auto min_elements_per_thread = std::size_t{1} << 14;
+
+// How many threads should share `size` elements, so that each of them gets at least `min_chunk`
+inline auto chunk_count(std::size_t size, std::size_t min_chunk) noexcept -> std::size_t
+{
+    auto const hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::clamp<std::size_t>(size / std::max(min_chunk, std::size_t{1}), 1, hardware);
+}
+
+// Where the `i`-th of the `chunks` chunks of [0, size) begins; the last one takes the remainder,
+//  and `chunk_begin(size, chunks, chunks)` is `size`
+constexpr auto chunk_begin(std::size_t size, std::size_t chunks, std::size_t i) noexcept -> std::size_t
+{
+    return i == chunks ? size : i * (size / chunks);
+}
+
+// Splits [0, size) in `chunks` contiguous chunks and calls `fn(chunk_index, begin, end)` for
+//  each of them: the first on the calling thread, the others on their own. The first
+//  exception is rethrown after all of them completed
+template <typename Fn>
+auto for_each_chunk(std::size_t size, std::size_t chunks, Fn && fn) -> void
+{
+    auto const bounds = [=](std::size_t i) {
+        return std::pair{chunk_begin(size, chunks, i), chunk_begin(size, chunks, i + 1)};
+    };
+
+    auto errors = std::vector<std::exception_ptr>(chunks);
+    {
+        auto workers = std::vector<std::jthread>{};
+        workers.reserve(chunks - 1);
+        for (auto i = std::size_t{1}; i < chunks; ++i) {
+            workers.emplace_back([&, i] {
+                try {
+                    auto const [begin, end] = bounds(i);
+                    fn(i, begin, end);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        try {
+            auto const [begin, end] = bounds(0);
+            fn(std::size_t{0}, begin, end);
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+    }  // joins the workers
+    for (auto const & error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+// Folds the projections of [first, first + size) keeping `Lanes` independent accumulators, so that
+//  the loop has no dependency between consecutive iterations and can be vectorized; the
+//  accumulators are then folded in order. Reorders the operations, so `op` must be associative and
+//  commutative. The accumulators have type `T`, which must be the type that the fold gives, so that
+//  e.g. `int` elements folded into a `long long` are not added up as `int`
+template <std::size_t Lanes, typename T, std::random_access_iterator It, typename Op, typename Proj>
+constexpr auto fold_lanes(It first, std::iter_difference_t<It> size, Op & op, Proj & proj) -> std::optional<T>
+{
+    if (size == 0) {
+        return std::nullopt;
+    }
+    if (size < static_cast<std::iter_difference_t<It>>(2 * Lanes)) {
+        auto result = static_cast<T>(std::invoke(proj, first[0]));
+        for (auto i = std::iter_difference_t<It>{1}; i < size; ++i) {
+            result = std::invoke(op, std::move(result), std::invoke(proj, first[i]));
+        }
+        return result;
+    }
+
+    constexpr auto lanes = static_cast<std::iter_difference_t<It>>(Lanes);
+    auto accumulators = [&]<std::size_t ...Idx>(std::index_sequence<Idx...>) {
+        return std::array<T, Lanes>{static_cast<T>(std::invoke(proj, first[Idx]))...};
+    }(std::make_index_sequence<Lanes>{});
+    auto i = lanes;
+    for (; i + lanes <= size; i += lanes) {
+        for (auto lane = std::iter_difference_t<It>{}; lane < lanes; ++lane) {
+            accumulators[lane] = std::invoke(op, std::move(accumulators[lane]), std::invoke(proj, first[i + lane]));
+        }
+    }
+    auto result = std::move(accumulators[0]);
+    for (auto lane = std::size_t{1}; lane < Lanes; ++lane) {
+        result = std::invoke(op, std::move(result), std::move(accumulators[lane]));
+    }
+    for (; i < size; ++i) {
+        result = std::invoke(op, std::move(result), std::invoke(proj, first[i]));
+    }
+    return result;
+}
+
+// Index of the first of the `size` elements from `first` whose truth value is `target`, or `size`:
+//  elements are tested a cache line at a time without branching, so that the compiler can compare
+//  a whole block with a few SIMD instructions, and the scan stops at the first matching block
+template <typename T>
+constexpr auto find_truth_value(T const * first, std::size_t size, bool target) noexcept -> std::size_t
+{
+    constexpr auto block = std::max<std::size_t>(64 / sizeof(T), 1);
+    auto i = std::size_t{};
+    for (; i + block <= size; i += block) {
+        // an integer, rather than a bool, lets GCC turn the loop in vector compares and ors
+        auto found = static_cast<unsigned char>(0);
+        for (auto j = std::size_t{}; j < block; ++j) {
+            found |= static_cast<unsigned char>((first[i + j] != T{}) == target);
+        }
+        if (found != 0) {
+            break;
+        }
+    }
+    for (; i < size; ++i) {
+        if (static_cast<bool>(first[i]) == target) {
+            return i;
+        }
+    }
+    return size;
+}
+}  // namespace detail
+}  // namespace callables
+
+#include "_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_DETAIL_PARALLEL_HPP */
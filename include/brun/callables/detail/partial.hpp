@@ -32,6 +32,7 @@
 #define CB_DETAIL_PARTIAL_HPP
 
 #include <concepts>
+#include <type_traits>
 #include <utility>
 #include "_config_begin.hpp"
 
@@ -67,35 +68,66 @@ constexpr auto forward_like(U&& x) noexcept -> auto &&
 }
 }  // namespace detail
 
+// a value known at compile time: bound with `fn(c<V>)`, `fn.left<V>()` or `fn.right<V>()`, it takes no
+//  storage and reaches the function as the prvalue `V`, so that the compiler can propagate it
+template <auto V>
+struct constant : std::integral_constant<decltype(V), V> {};
+
+template <auto V>
+constexpr inline constant<V> c;
+
+namespace detail
+{
+template <typename T>
+struct bound { using type = T; };
+template <auto V>
+struct bound<constant<V>> { using type = decltype(V); };
+
+template <typename T>
+using bound_t = typename bound<T>::type;
+
+template <typename T>
+constexpr auto bound_value(T const & t) noexcept -> T const & { return t; }
+template <auto V>
+constexpr auto bound_value(constant<V>) noexcept { return V; }
+}  // namespace detail
+
 template <typename Fn, typename T>
 struct partial
 {
 private:
-    T _t;
+    [[no_unique_address]] T _t;  // stateless bound values take no storage
 
 public:
     template <typename U> requires std::constructible_from<T, U>
     constexpr explicit partial(U && u) : _t{CB_FWD(u)} {}
 
-    template <typename ...U> requires std::regular_invocable<Fn, T, U...>
+    // the bound value, as the function receives it
+    [[nodiscard]] constexpr auto bound() const noexcept -> decltype(auto) { return detail::bound_value(_t); }
+
+    template <typename ...U> requires std::regular_invocable<Fn, detail::bound_t<T>, U...>
     [[nodiscard]] constexpr
-    auto operator()(U &&... u) const noexcept(noexcept(Fn{}(_t, CB_FWD(u)...))) -> decltype(auto)
-    { return Fn{}(_t, CB_FWD(u)...); }
+    auto operator()(U &&... u) const noexcept(noexcept(Fn{}(detail::bound_value(_t), CB_FWD(u)...))) -> decltype(auto)
+    { return Fn{}(detail::bound_value(_t), CB_FWD(u)...); }
 };
 
 template <typename Fn, typename T>
 struct right_partial
 {
 private:
-    T _t;
+    [[no_unique_address]] T _t;  // stateless bound values take no storage
 
 public:
     template <typename U> requires std::constructible_from<T, U>
     constexpr explicit right_partial(U && u) : _t{CB_FWD(u)} {}
-    template <typename ...U> requires std::regular_invocable<Fn, U..., T>
+
+    // the bound value, as the function receives it
+    [[nodiscard]] constexpr auto bound() const noexcept -> decltype(auto) { return detail::bound_value(_t); }
+
+    template <typename ...U> requires std::regular_invocable<Fn, U..., detail::bound_t<T>>
     [[nodiscard]] constexpr
-    auto operator()(U &&... u) const noexcept(noexcept(Fn{}(CB_FWD(u)..., _t))) -> decltype(auto)
-    { return Fn{}(CB_FWD(u)..., _t); }
+    auto operator()(U &&... u) const noexcept(noexcept(Fn{}(CB_FWD(u)..., detail::bound_value(_t)))) -> decltype(auto)
+    { return Fn{}(CB_FWD(u)..., detail::bound_value(_t)); }
 };
 
 template <typename Base>
@@ -114,6 +146,14 @@ struct binary_fn
     static auto right(T && t) noexcept(noexcept(right_partial<base, std::unwrap_ref_decay_t<T>>{CB_FWD(t)}))
     { return right_partial<base, std::unwrap_ref_decay_t<T>>{CB_FWD(t)}; }
 
+    template <auto V>
+    [[nodiscard]] constexpr
+    static auto left() noexcept { return partial<base, constant<V>>{c<V>}; }
+
+    template <auto V>
+    [[nodiscard]] constexpr
+    static auto right() noexcept { return right_partial<base, constant<V>>{c<V>}; }
+
     template <typename T>
     [[nodiscard]] constexpr CB_STATIC
     auto operator()(T && t) CB_CONST noexcept(noexcept(left(CB_FWD(t))))
@@ -0,0 +1,241 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 19:12:48 CEST
+ * @description : LSD radix sort on integer and floating point keys, used by `sort`
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_DETAIL_RADIX_SORT_HPP
+#define CB_DETAIL_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "_config_begin.hpp"
+
+namespace callables::detail
+{
+
+// Keys that `radix_sort` can order: integers, and floating points in the IEEE-754 binary32 or
+//  binary64 formats
+template <typename T>
+concept radix_key = std::integral<T> or (
+    std::floating_point<T> and std::numeric_limits<T>::is_iec559 and (sizeof(T) == 4 or sizeof(T) == 8)
+);
+
+// Below this many elements a comparison sort is faster than a radix sort on `Bytes` bytes long keys
+template <std::size_t Bytes>
+constexpr inline auto radix_sort_threshold = std::size_t{512} * Bytes;
+
+// Above this many elements, sorting them by their positions is worth only with short keys
+constexpr inline auto radix_gather_limit = std::size_t{1} << 16;
+
+// Maps `key` on an unsigned integer with the same ordering
+template <radix_key T>
+[[nodiscard]] constexpr auto to_radix(T key) noexcept
+{
+    if constexpr (std::same_as<T, bool>) {
+        return static_cast<std::uint8_t>(key);
+    } else if constexpr (std::integral<T>) {
+        using unsigned_t = std::make_unsigned_t<T>;
+        constexpr auto sign = std::is_signed_v<T> ? unsigned_t{1} << (sizeof(T) * 8 - 1) : unsigned_t{};
+        return static_cast<unsigned_t>(static_cast<unsigned_t>(key) ^ sign);
+    } else {
+        using unsigned_t = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+        constexpr auto sign = unsigned_t{1} << (sizeof(T) * 8 - 1);
+        auto const bits = std::bit_cast<unsigned_t>(key);
+        // negative numbers are ordered backwards, so all their bits are flipped
+        return static_cast<unsigned_t>((bits & sign) != 0 ? ~bits : bits | sign);
+    }
+}
+
+// The inverse of `to_radix<T>`
+template <radix_key T, std::unsigned_integral U>
+[[nodiscard]] constexpr auto from_radix(U bits) noexcept -> T
+{
+    if constexpr (std::same_as<T, bool>) {
+        return bits != 0;
+    } else if constexpr (std::integral<T>) {
+        constexpr auto sign = std::is_signed_v<T> ? U{1} << (sizeof(T) * 8 - 1) : U{};
+        return static_cast<T>(static_cast<U>(bits ^ sign));
+    } else {
+        constexpr auto sign = U{1} << (sizeof(T) * 8 - 1);
+        return std::bit_cast<T>(static_cast<U>((bits & sign) != 0 ? bits & ~sign : ~bits));
+    }
+}
+
+// Sorts `records` by `key_of(record)`, an unsigned integer of `Bytes` bytes at most: a stable
+//  counting sort for each byte, from the least significant, skipping the bytes which are the same
+//  for every key
+template <std::size_t Bytes, typename Record, typename KeyOf>
+auto radix_passes(std::vector<Record> & records, KeyOf key_of) -> void
+{
+    auto histograms = std::array<std::array<std::size_t, 256>, Bytes>{};
+    for (auto const & record : records) {
+        auto const key = key_of(record);
+        for (auto pass = std::size_t{}; pass < Bytes; ++pass) {
+            ++histograms[pass][(key >> (8 * pass)) & 0xFF];
+        }
+    }
+
+    auto const size = records.size();
+    auto buffer = std::vector<Record>{};
+    for (auto pass = std::size_t{}; pass < Bytes; ++pass) {
+        auto & counts = histograms[pass];
+        if (std::ranges::find(counts, size) != counts.end()) {
+            continue;
+        }
+        if (buffer.empty()) {
+            buffer.resize(size);
+        }
+        auto offset = std::size_t{};
+        for (auto & count : counts) {
+            offset += std::exchange(count, offset);
+        }
+        for (auto const & record : records) {
+            buffer[counts[(key_of(record) >> (8 * pass)) & 0xFF]++] = record;
+        }
+        records.swap(buffer);
+    }
+}
+
+// Calls `sort.template operator()<Bytes>()` with the number of bytes needed by keys up to `span`,
+//  so that values clustered around any point are sorted in as few passes as possible
+template <std::unsigned_integral Key, typename Sort>
+auto with_key_bytes(Key span, Sort && sort) -> void
+{
+    auto const bytes = (std::bit_width(span) + 7) / 8;
+    if constexpr (sizeof(Key) > 4) {
+        if (bytes > 4) {
+            return sort.template operator()<sizeof(Key)>();
+        }
+    }
+    if constexpr (sizeof(Key) > 2) {
+        if (bytes > 2) {
+            return sort.template operator()<std::min<std::size_t>(sizeof(Key), 4)>();
+        }
+    }
+    if (bytes > 1) {
+        return sort.template operator()<std::min<std::size_t>(sizeof(Key), 2)>();
+    }
+    return sort.template operator()<1>();
+}
+
+/**
+ * @brief sorts the `size` integers or floating points from `first`, in ascending order or in
+ *  descending order if `Descending`: they are mapped on unsigned keys, sorted as such and mapped back
+ */
+template <bool Descending, std::random_access_iterator I>
+    requires radix_key<std::iter_value_t<I>>
+auto radix_sort_values(I first, std::size_t size) -> void
+{
+    using value_t = std::iter_value_t<I>;
+    using key_t = decltype(to_radix(value_t{}));
+    using diff_t = std::iter_difference_t<I>;
+
+    auto keys = std::vector<key_t>(size);
+    for (auto i = std::size_t{}; i < size; ++i) {
+        auto const key = to_radix(static_cast<value_t>(first[static_cast<diff_t>(i)]));
+        keys[i] = Descending ? static_cast<key_t>(~key) : key;
+    }
+    auto const [min, max] = std::ranges::minmax(keys);
+    for (auto & key : keys) {
+        key = static_cast<key_t>(key - min);
+    }
+    with_key_bytes(static_cast<key_t>(max - min), [&]<std::size_t Bytes>() {
+        radix_passes<Bytes>(keys, [](key_t key) { return key; });
+    });
+    for (auto i = std::size_t{}; i < size; ++i) {
+        auto const key = static_cast<key_t>(keys[i] + min);
+        first[static_cast<diff_t>(i)] = from_radix<value_t>(Descending ? static_cast<key_t>(~key) : key);
+    }
+}
+
+/**
+ * @brief sorts the `size` elements from `first` by `proj(element)`, in ascending order or in
+ *  descending order if `Descending`: the keys are sorted with their positions, and then each
+ *  element is moved once to its place. Equal keys keep their relative order.
+ *  Gives up and leaves the elements untouched when the keys are spread on more than 4 bytes and the
+ *  elements are more than `radix_gather_limit`: moving them from random positions would then cost
+ *  more than the comparisons saved
+ */
+template <bool Descending, std::random_access_iterator I, typename Proj>
+auto radix_sort(I first, std::size_t size, Proj & proj) -> bool
+{
+    using key_t = decltype(to_radix(std::invoke(proj, *first)));
+    using index_t = std::uint32_t;
+    using diff_t = std::iter_difference_t<I>;
+
+    struct entry
+    {
+        key_t key;
+        index_t index;
+    };
+    auto const key_of = [&](std::size_t i) {
+        auto const key = to_radix(std::invoke(proj, first[static_cast<diff_t>(i)]));
+        return Descending ? static_cast<key_t>(~key) : key;
+    };
+    auto min = std::numeric_limits<key_t>::max();
+    auto max = std::numeric_limits<key_t>::min();
+    for (auto i = std::size_t{}; i < size; ++i) {
+        auto const key = key_of(i);
+        min = std::min(min, key);
+        max = std::max(max, key);
+    }
+    if (size > radix_gather_limit and std::bit_width(static_cast<key_t>(max - min)) > 32) {
+        return false;
+    }
+
+    auto entries = std::vector<entry>(size);
+    for (auto i = std::size_t{}; i < size; ++i) {
+        entries[i] = {key_of(i), static_cast<index_t>(i)};
+    }
+    with_key_bytes(static_cast<key_t>(max - min), [&]<std::size_t Bytes>() {
+        radix_passes<Bytes>(entries, [min](entry const & e) { return static_cast<key_t>(e.key - min); });
+    });
+
+    auto sorted = std::vector<std::iter_value_t<I>>{};
+    sorted.reserve(size);
+    for (auto const & e : entries) {
+        sorted.push_back(std::ranges::iter_move(first + static_cast<diff_t>(e.index)));
+    }
+    std::ranges::move(sorted, first);
+    return true;
+}
+
+}  // namespace callables::detail
+
+#include "_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_DETAIL_RADIX_SORT_HPP */
@@ -31,8 +31,22 @@
 #ifndef CB_FORMAT_HPP
 #define CB_FORMAT_HPP
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include "detail/format_string.hpp"
 #include "detail/_config_begin.hpp"
 
 #if CB_HAS_FORMAT == 1
@@ -53,12 +67,128 @@ namespace callables
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
 // .................................TO_STRING.................................. //
 // ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+/**
+ * @brief a string of at most `Capacity` characters stored in place, returned by `to_string.inline_<N>`
+ *  so that formatting does not allocate; what does not fit is dropped, and `truncated()` reports it
+ */
+template <std::size_t Capacity>
+class inline_string
+{
+    std::array<char, Capacity> _data{};
+    std::size_t _size = 0;
+    bool _truncated = false;
+
+public:
+    using value_type = char;
+
+    constexpr inline_string() = default;
+
+    constexpr auto push_back(char ch) noexcept -> void { append(&ch, 1); }
+
+    constexpr auto append(char const * data, std::size_t size) noexcept -> void
+    {
+        auto const count = std::min(size, Capacity - _size);
+        std::copy_n(data, count, _data.begin() + _size);
+        _size += count;
+        _truncated = _truncated or count < size;
+    }
+
+    [[nodiscard]] constexpr auto data() const noexcept -> char const * { return _data.data(); }
+    [[nodiscard]] constexpr auto data() noexcept -> char * { return _data.data(); }
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return _size; }
+    [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t { return Capacity; }
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return _size == 0; }
+    [[nodiscard]] constexpr auto truncated() const noexcept -> bool { return _truncated; }
+    [[nodiscard]] constexpr auto begin() const noexcept { return _data.begin(); }
+    [[nodiscard]] constexpr auto end() const noexcept { return _data.begin() + _size; }
+    [[nodiscard]] constexpr auto view() const noexcept -> std::string_view { return {_data.data(), _size}; }
+    [[nodiscard]] constexpr operator std::string_view() const noexcept { return view(); }
+
+    [[nodiscard]] friend constexpr auto operator==(inline_string const & lhs, std::string_view rhs) noexcept -> bool
+    { return lhs.view() == rhs; }
+};
+
+template <std::size_t Capacity>
+struct to_inline_string_t
+{
+    // Numbers and booleans must always fit: a truncated number would just be a different number
+    template <typename T>
+        requires (not detail::plainly_formattable<T>) or (Capacity >= detail::max_plain_length<T>)
+    [[nodiscard]] CB_STATIC constexpr auto operator()(T const & t) CB_CONST -> inline_string<Capacity>
+    {
+        auto result = inline_string<Capacity>{};
+        if constexpr (detail::plainly_formattable<T>) {
+            detail::write_plain(result, t);
+        } else {
+            // one character more than fits, so that `result` sees the overflow and flags it
+            std::format_to_n(std::back_inserter(result), Capacity + 1, "{}", t);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief integers, floating points, booleans, characters and strings are written directly, with
+ *  integers converted two digits at a time; any other type goes through `std::format("{}", t)`
+ */
 struct to_string_t
 {
+    /**
+     * @brief the same conversion, in an `inline_string<Capacity>` instead of a `std::string`
+     */
+    template <std::size_t Capacity>
+    static constexpr auto inline_ = to_inline_string_t<Capacity>{};
+
     template <typename T>
     [[nodiscard]] CB_STATIC constexpr auto operator()(T const & t) CB_CONST -> std::string
-    { return std::format("{}", t); }
+    {
+        if constexpr (detail::plainly_formattable<T>) {
+            auto result = std::string{};
+            auto sink = detail::string_sink{result};
+            detail::write_plain(sink, t);
+            return result;
+        } else {
+            return std::format("{}", t);
+        }
+    }
+
+    template <std::output_iterator<char const &> Out, typename T>
+    static constexpr auto to(Out out, T const & t) -> Out
+    {
+        if constexpr (detail::plainly_formattable<T>) {
+            auto sink = detail::iterator_sink<Out>{std::move(out)};
+            detail::write_plain(sink, t);
+            return std::move(sink).iterator();
+        } else {
+            return std::format_to(std::move(out), "{}", t);
+        }
+    }
 
+    template <typename T>
+    [[nodiscard]] static constexpr auto into(std::span<char> buffer, T const & t) -> std::size_t
+    {
+        if constexpr (detail::plainly_formattable<T>) {
+            auto sink = detail::buffer_sink{buffer.data(), buffer.data() + buffer.size()};
+            detail::write_plain(sink, t);
+            return sink.written;
+        } else {
+            auto const result = std::format_to_n(buffer.data(), std::ssize(buffer), "{}", t);
+            return static_cast<std::size_t>(result.out - buffer.data());
+        }
+    }
+
+    template <typename T>
+    static constexpr auto to_string_into(std::string & str, T const & t) -> std::string &
+    {
+        str.clear();
+        if constexpr (detail::plainly_formattable<T>) {
+            auto sink = detail::string_sink{str};
+            detail::write_plain(sink, t);
+        } else {
+            std::format_to(std::back_inserter(str), "{}", t);
+        }
+        return str;
+    }
 };
 
 constexpr inline to_string_t to_string;
@@ -84,13 +214,156 @@ struct fixed_string
 template<class T, std::size_t Capacity, std::size_t Size = Capacity - 1>
 fixed_string(const T (&str)[Capacity]) -> fixed_string<T, Size>;
 
+namespace detail
+{
+// `Fmt` is a valid format string for `Ts`, as `std::format` checks at compile time
+template <auto Fmt, typename ...Ts>
+concept format_string_for = requires {
+    typename std::integral_constant<bool, (std::format_string<Ts const &...>{std::string_view{Fmt}}, true)>;
+};
+
+// An argument with the formatter that already parsed its spec: formatting it as "{}" hands it
+//  the format context, which only `std::format` can build
+template <typename T, typename Formatter>
+struct preformatted
+{
+    T const & value;
+    Formatter const & formatter;
+};
+}  // namespace detail
+}  // namespace callables
+
+template <typename T, typename Formatter>
+struct std::formatter<callables::detail::preformatted<T, Formatter>, char>
+{
+    constexpr auto parse(std::format_parse_context & ctx) { return ctx.begin(); }
+
+    template <typename Context>
+    constexpr auto format(callables::detail::preformatted<T, Formatter> const & arg, Context & ctx) const
+    {
+        return arg.formatter.format(arg.value, ctx);
+    }
+};
+
+namespace callables
+{
+template <fixed_string Fmt>
+struct compiled_format_t
+{
+    template <typename ...Ts>
+        requires detail::format_string_for<Fmt, Ts...>
+    [[nodiscard]] CB_STATIC constexpr auto operator()(Ts const &... ts) CB_CONST -> std::string {
+        auto result = std::string{};
+        to_string_into(result, ts...);
+        return result;
+    }
+
+    template <std::output_iterator<char const &> Out, typename ...Ts>
+        requires detail::format_string_for<Fmt, Ts...>
+    static constexpr auto to(Out out, Ts const &... ts) -> Out {
+        if constexpr (not parsed::supported) {
+            return std::format_to(std::move(out), Fmt, ts...);
+        } else {
+            auto sink = detail::iterator_sink<Out>{std::move(out)};
+            detail::write_compiled<Fmt>(sink, _format_field, ts...);
+            return std::move(sink).iterator();
+        }
+    }
+
+    template <typename ...Ts>
+        requires detail::format_string_for<Fmt, Ts...>
+    static constexpr auto to_string_into(std::string & str, Ts const &... ts) -> std::string & {
+        str.clear();
+        if constexpr (not parsed::supported) {
+            std::format_to(std::back_inserter(str), Fmt, ts...);
+        } else {
+            auto sink = detail::string_sink{str};
+            detail::write_compiled<Fmt>(sink, _format_field, ts...);
+        }
+        return str;
+    }
+
+private:
+    using parsed = detail::compiled_format_string<Fmt>;
+
+    // The formatter of the field at `Idx`, with its spec parsed
+    template <typename T, std::size_t Idx>
+    static constexpr auto _parse_field() -> std::formatter<T, char>
+    {
+        auto formatter = std::formatter<T, char>{};
+        auto context = std::format_parse_context{parsed::template field_spec<Idx>};
+        formatter.parse(context);
+        return formatter;
+    }
+
+    static constexpr auto _format_field = []<std::size_t Idx>(auto & sink, std::integral_constant<std::size_t, Idx>,
+                                                             auto const & arg) {
+        using arg_t = std::remove_cvref_t<decltype(arg)>;
+        // constant-initialized when the spec can be parsed at compile time, as with the standard
+        //  formatters; otherwise parsed on the first call only
+        static auto const formatter = _parse_field<arg_t, Idx>();
+        using preformatted = detail::preformatted<arg_t, std::formatter<arg_t, char>>;
+        sink.advance(std::format_to(std::move(sink).iterator(), "{}", preformatted{arg, formatter}));
+    };
+};
+
 template <fixed_string Fmt>
 struct format_t
 {
+    /**
+     * @brief the same formatting, with `Fmt` checked against the arguments and split in literal chunks
+     *  and fields at compile time: literals are copied as they are, fields without a spec holding
+     *  integers, floating points, booleans, characters or strings are converted directly, and the
+     *  remaining fields are written by their `std::formatter`, whose spec is parsed only once, at
+     *  compile time when the formatter allows it. Format strings with nested replacement fields
+     *  (e.g. "{:{}}") are formatted by `std::format`
+     */
+    [[no_unique_address]] compiled_format_t<Fmt> compiled;
+
     template <typename ...Ts>
     [[nodiscard]] CB_STATIC constexpr auto operator()(Ts &&... ts) CB_CONST {
         return std::format(Fmt, CB_FWD(ts)...);
     }
+
+    /**
+     * @brief writes the formatted arguments through an output iterator
+     *
+     * @return the iterator past the last written character
+     */
+    template <std::output_iterator<char const &> Out, typename ...Ts>
+    static constexpr auto to(Out out, Ts &&... ts) -> Out {
+        return std::format_to(std::move(out), Fmt, CB_FWD(ts)...);
+    }
+
+    /**
+     * @brief writes the formatted arguments in a caller-provided buffer, truncating the output
+     *  if it does not fit
+     *
+     * @return the number of characters written; compare it with `formatted_size` to detect truncation
+     */
+    template <typename ...Ts>
+    [[nodiscard]] static constexpr auto into(std::span<char> buffer, Ts &&... ts) -> std::size_t {
+        auto const result = std::format_to_n(buffer.data(), std::ssize(buffer), Fmt, CB_FWD(ts)...);
+        return static_cast<std::size_t>(result.out - buffer.data());
+    }
+
+    /**
+     * @brief the number of characters the formatted arguments need, without writing them
+     */
+    template <typename ...Ts>
+    [[nodiscard]] static constexpr auto formatted_size(Ts &&... ts) -> std::size_t {
+        return std::formatted_size(Fmt, CB_FWD(ts)...);
+    }
+
+    /**
+     * @brief replaces the content of `str` with the formatted arguments, reusing its capacity
+     */
+    template <typename ...Ts>
+    static constexpr auto to_string_into(std::string & str, Ts &&... ts) -> std::string & {
+        str.clear();
+        std::format_to(std::back_inserter(str), Fmt, CB_FWD(ts)...);
+        return str;
+    }
 };
 
 template <fixed_string Fmt>
@@ -171,11 +444,56 @@ struct use_expected {
 };
 }  // namespace policy
 
+namespace detail
+{
+// SWAR helpers for `ston_fn::batch`: up to 8 characters are packed in a word, the
+//  first one in the lowest byte, so they can be validated and converted all at once
+[[nodiscard]] constexpr auto load_8_chars(char const * ptr) noexcept -> std::uint64_t
+{
+    auto word = std::uint64_t{};
+    for (auto i = 0; i < 8; ++i) {
+        word |= std::uint64_t{static_cast<unsigned char>(ptr[i])} << (8 * i);
+    }
+    return word;
+}
+
+// Number of decimal digits at the beginning of the packed word, in [0, 8]
+[[nodiscard]] constexpr auto leading_8_digits(std::uint64_t word) noexcept -> int
+{
+    constexpr auto high_nibbles = std::uint64_t{0xF0F0F0F0F0F0F0F0};
+    constexpr auto zeros        = std::uint64_t{0x3030303030303030};
+    constexpr auto low_bits     = std::uint64_t{0x7F7F7F7F7F7F7F7F};
+    // a byte is zero iff it is in ['0', '9']: its high nibble is 3, also after adding 6
+    auto const not_digit = ((word & high_nibbles) ^ zeros)
+                         | (((word + 0x0606060606060606) & high_nibbles) ^ zeros);
+    auto const non_zero_bytes = (((not_digit & low_bits) + low_bits) | not_digit) & ~low_bits;
+    return std::countr_zero(non_zero_bytes) / 8;
+}
+
+// Converts 8 packed decimal digits with three multiplications
+[[nodiscard]] constexpr auto parse_8_digits(std::uint64_t word) noexcept -> std::uint64_t
+{
+    constexpr auto mask = std::uint64_t{0x000000FF000000FF};
+    constexpr auto mul1 = std::uint64_t{100 + (1000000ull << 32)};
+    constexpr auto mul2 = std::uint64_t{1 + (10000ull << 32)};
+    word -= 0x3030303030303030;
+    word = (word * 10) + (word >> 8);
+    return (((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32;
+}
+
+static_assert(leading_8_digits(load_8_chars("12345678")) == 8);
+static_assert(leading_8_digits(load_8_chars("1234-678")) == 4);
+static_assert(leading_8_digits(load_8_chars(":/123456")) == 0);
+static_assert(parse_8_digits(load_8_chars("12345678")) == 12345678);
+static_assert(parse_8_digits(load_8_chars("00000009")) == 9);
+}  // namespace detail
+
 template <typename Num, int Base, typename ResultPolicy>
 struct ston_fn
 {
     using number = std::remove_cvref_t<Num>;
     using result_policy = ResultPolicy;
+    using result_type = typename result_policy::template result_t<number>;
 
     static constexpr auto use_exception = std::same_as<result_policy, policy::use_exception>;
 
@@ -185,7 +503,7 @@ struct ston_fn
     }
 
     template <typename T>
-    static constexpr auto make_failure(T && t) noexcept(use_exception) {
+    static constexpr auto make_failure(T && t) noexcept(not use_exception) {
         return result_policy::template make_failure<number>(std::move(t));
     }
 
@@ -217,6 +535,99 @@ struct ston_fn
         return make_failure(ec);
     }
 
+    // Base-10 integer parsing of a whole field; fields with more than 19 significant
+    //  digits are rare enough to be left to `std::from_chars`
+    [[nodiscard]] static constexpr
+    auto _parse_decimal(std::string_view field) noexcept -> std::pair<number, std::errc>
+    {
+        auto ptr = field.data();
+        auto const last = ptr + field.size();
+
+        auto negative = false;
+        if constexpr (std::is_signed_v<number>) {
+            if (ptr != last and *ptr == '-') {
+                negative = true;
+                ++ptr;
+            }
+        }
+        auto const digits = ptr;
+        while (ptr != last and *ptr == '0') {
+            ++ptr;
+        }
+        auto const significant = ptr;
+
+        while (last - ptr >= 8) {
+            auto const count = detail::leading_8_digits(detail::load_8_chars(ptr));
+            ptr += count;
+            if (count != 8) {
+                break;
+            }
+        }
+        if (last - ptr < 8) {
+            while (ptr != last and *ptr >= '0' and *ptr <= '9') {
+                ++ptr;
+            }
+        }
+        if (ptr == digits) {
+            return {number{}, std::errc::invalid_argument};
+        }
+        if (ptr - significant > 19) {
+            auto result = number{};
+            auto [end, ec] = std::from_chars(field.data(), last, result);
+            return {result, ec == std::errc() and end != last ? std::errc::invalid_argument : ec};
+        }
+
+        auto acc = std::uint64_t{};
+        auto it = significant;
+        for (; ptr - it >= 8; it += 8) {
+            acc = acc * 100000000 + detail::parse_8_digits(detail::load_8_chars(it));
+        }
+        for (; it != ptr; ++it) {
+            acc = acc * 10 + static_cast<std::uint64_t>(*it - '0');
+        }
+
+        using unsigned_t = std::make_unsigned_t<number>;
+        constexpr auto max = static_cast<std::uint64_t>(std::numeric_limits<number>::max());
+        if (acc > max + negative) {
+            return {number{}, std::errc::result_out_of_range};
+        }
+        if (ptr != last) {
+            return {number{}, std::errc::invalid_argument};
+        }
+        if (negative) {
+            return {static_cast<number>(static_cast<unsigned_t>(0 - acc)), std::errc()};
+        }
+        return {static_cast<number>(acc), std::errc()};
+    }
+
+    /**
+     * @brief parses every field in `fields`, storing the outcome in the corresponding element
+     *  of `results` according to the result policy
+     *
+     * Base-10 integers are validated and converted 8 characters at a time; everything else
+     *  is parsed one field after the other as `operator()` would do.
+     * With `policy::use_exception` the first failure throws, leaving the previous results set.
+     *
+     * @param fields the strings to parse
+     * @param results where to store the results, at least as long as `fields`
+     * @return the prefix of `results` that has been written
+     */
+    static constexpr
+    auto batch(std::span<std::string_view const> fields, std::span<result_type> results)
+        noexcept(not use_exception) -> std::span<result_type>
+    {
+        auto const size = std::min(fields.size(), results.size());
+        for (auto i = std::size_t{}; i < size; ++i) {
+            if constexpr (Base == 10 and std::integral<number> and not std::same_as<number, bool>) {
+                auto [value, ec] = _parse_decimal(fields[i]);
+                results[i] = ec == std::errc() ? make_result(value) : make_failure(ec);
+            } else {
+                results[i] = ston_fn{}(fields[i]);
+            }
+        }
+        return results.first(size);
+    }
+
     // Basically copying the implementation from GCC's <charconv>
     template <std::input_iterator It, std::sentinel_for<It> Sent>
         requires (std::same_as<std::iter_value_t<It>, char> and not std::floating_point<number>)
@@ -302,50 +713,227 @@ struct ston_fn
         return make_result(res * sign);
     }
 
+    // Floating point parsing in a single pass over the input: the first 19 significant digits
+    //  are accumulated in an integer and the following ones, up to the 768 that can affect the
+    //  rounding, are kept aside. Exact cases are computed with one multiplication or division
+    //  (Clinger's fast path), the others rebuild a compact representation on the stack and rely
+    //  on `std::from_chars` (Eisel-Lemire with a correctly rounded fallback) for the rounding
+    static constexpr auto max_mantissa_digits = 19;
+    static constexpr auto max_significant_digits = 768;
+
+    template <std::input_iterator It, std::sentinel_for<It> Sent>
+    [[nodiscard]] static constexpr
+    auto _match(It & begin, Sent & end, std::string_view lowercase) noexcept -> bool
+    {
+        for (auto ch : lowercase) {
+            if (begin == end or (*begin | 0x20) != ch) {
+                return false;
+            }
+            ++begin;
+        }
+        return true;
+    }
+
+    // "inf", "infinity", "nan" and "nan(n-char-sequence)", case insensitive; a NUL ends the input, as the
+    //  terminator of a string literal
+    template <std::input_iterator It, std::sentinel_for<It> Sent>
+    [[nodiscard]] static constexpr
+    auto _parse_special(It & begin, Sent & end) noexcept -> std::optional<number>
+    {
+        if ((*begin | 0x20) == 'i') {
+            if (not _match(begin, end, "inf")
+                or (begin != end and *begin != '\0' and not _match(begin, end, "inity"))) {
+                return std::nullopt;
+            }
+            return std::numeric_limits<number>::infinity();
+        }
+        if (not _match(begin, end, "nan")) {
+            return std::nullopt;
+        }
+        if (begin != end and *begin == '(') {
+            for (++begin; begin != end and *begin != ')'; ++begin) {
+                auto const ch = *begin;
+                auto const lower = ch | 0x20;
+                if (not (ch >= '0' and ch <= '9') and not (lower >= 'a' and lower <= 'z') and ch != '_') {
+                    return std::nullopt;
+                }
+            }
+            if (begin == end) {
+                return std::nullopt;
+            }
+            ++begin;
+        }
+        return std::numeric_limits<number>::quiet_NaN();
+    }
+
+    // 10^k is exact as long as 5^k fits in the significand; only filled for floating points,
+    //  since the class is instantiated for integers too
+    static constexpr auto _exact_powers_of_ten = [] {
+        auto result = std::array<number, 28>{1};
+        auto five = std::uint64_t{1};
+        auto size = std::size_t{1};
+        for (; std::floating_point<number> and size < result.size()
+               and std::bit_width(five * 5) <= std::numeric_limits<number>::digits; ++size) {
+            five *= 5;
+            result[size] = result[size - 1] * 10;
+        }
+        return std::pair{result, static_cast<std::int64_t>(size)};
+    }();
+
+    [[nodiscard]] static constexpr
+    auto _exact_fast_path(std::uint64_t mantissa, std::int64_t scale) noexcept -> std::optional<number>
+    {
+        auto const & [powers, size] = _exact_powers_of_ten;
+        if (std::bit_width(mantissa) > std::numeric_limits<number>::digits or scale <= -size or scale >= size) {
+            return std::nullopt;
+        }
+        auto const value = static_cast<number>(mantissa);
+        if (scale < 0) {
+            return value / powers[static_cast<std::size_t>(-scale)];
+        }
+        return value * powers[static_cast<std::size_t>(scale)];
+    }
+
+    // `value = (mantissa digits)(tail digits)(1 if sticky) * 10^scale`
+    [[nodiscard]] static constexpr
+    auto _correctly_rounded(
+        std::uint64_t mantissa, std::span<char const> tail, bool sticky, std::int64_t scale
+    ) noexcept -> std::pair<number, std::errc>
+    {
+        if consteval {
+            // Not correctly rounded, but there is no `from_chars` during constant evaluation
+            auto value = static_cast<long double>(mantissa);
+            scale += static_cast<std::int64_t>(tail.size());
+            for (; scale > 0 and value <= std::numeric_limits<number>::max(); --scale) { value *= 10; }
+            for (; scale < 0 and value != 0; ++scale) { value /= 10; }
+            if (value > std::numeric_limits<number>::max()) {
+                return {number{}, std::errc::result_out_of_range};
+            }
+            return {static_cast<number>(value), std::errc()};
+        } else {
+            auto buffer = std::array<char, max_significant_digits + 32>{};
+            auto const last = buffer.data() + buffer.size();
+            auto ptr = std::to_chars(buffer.data(), last, mantissa).ptr;
+            ptr = std::ranges::copy(tail, ptr).out;
+            if (sticky) {
+                *ptr++ = '1';
+                --scale;
+            }
+            *ptr++ = 'e';
+            ptr = std::to_chars(ptr, last, scale).ptr;
+
+            auto value = number{};
+            auto const [_, ec] = std::from_chars(buffer.data(), ptr, value);
+            return {value, ec};
+        }
+    }
+
     template <std::input_iterator It, std::sentinel_for<It> Sent>
         requires (std::same_as<std::iter_value_t<It>, char> and std::floating_point<number>)
     [[nodiscard]] CB_STATIC constexpr
     auto _impl(It && begin, Sent && end) noexcept(not use_exception)
     {
+        while (begin != end and *begin == '\0') {
+            ++begin;
+        }
         if (begin == end) {
-            return number{};
+            return make_failure(std::errc::invalid_argument);
         }
 
-        auto sign = 1;
-        auto res = number{};
-        auto decimal = std::optional<number>{};
+        auto negative = false;
+        if (*begin == '-') {
+            negative = true;
+            ++begin;
+        }
+        auto const with_sign = [negative](number value) { return negative ? -value : value; };
+        // ranges over string literals carry their terminator along
+        auto const at_end = [&begin, &end] {
+            while (begin != end and *begin == '\0') {
+                ++begin;
+            }
+            return begin == end;
+        };
 
-        do {
-            auto first = *begin++;
-            if (first == '\0') {
+        if (begin != end and ((*begin | 0x20) == 'i' or (*begin | 0x20) == 'n')) {
+            auto special = _parse_special(begin, end);
+            if (not special or not at_end()) {
+                return make_failure(std::errc::invalid_argument);
+            }
+            return make_result(with_sign(*special));
+        }
+
+        auto mantissa = std::uint64_t{};
+        auto tail = std::array<char, max_significant_digits - max_mantissa_digits>{};
+        auto significant_digits = 0;
+        auto sticky = false;
+        auto scale = std::int64_t{};
+        auto any_digit = false;
+        auto fraction = false;
+
+        for (; begin != end; ++begin) {
+            auto const ch = *begin;
+            if (ch == '.' and not fraction) {
+                fraction = true;
                 continue;
             }
-            if (first == '-') {
-                sign = -1;
-            } else if (first == '.') {
-                decimal = 1. / Base;
+            if (ch < '0' or ch > '9') {
+                break;
+            }
+            any_digit = true;
+            if (significant_digits == 0 and ch == '0') {
+                scale -= fraction;
+            } else if (significant_digits < max_mantissa_digits) {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>(ch - '0');
+                ++significant_digits;
+                scale -= fraction;
+            } else if (significant_digits < max_significant_digits) {
+                tail[static_cast<std::size_t>(significant_digits++ - max_mantissa_digits)] = ch;
+                scale -= fraction;
             } else {
-                res = first - '0';
+                sticky |= ch != '0';
+                scale += not fraction;
             }
-            break;
-        } while (true);
+        }
+        if (not any_digit) {
+            return make_failure(std::errc::invalid_argument);
+        }
 
-        while (begin != end) {
-            auto tmp = *begin++;
-            if (tmp == '.' and not decimal) {
-                decimal = 1. / Base;
-                continue;
+        // As with `std::from_chars`, trailing characters are reported only if the number is in range
+        auto trailing = false;
+        if (begin != end and (*begin == 'e' or *begin == 'E')) {
+            ++begin;
+            auto negative_exponent = false;
+            if (begin != end and (*begin == '-' or *begin == '+')) {
+                negative_exponent = *begin == '-';
+                ++begin;
             }
-            auto val = tmp - '0';
-            if (not decimal) {
-                res = res * Base + val;
-            } else {
-                res = res + *decimal * val;
-                *decimal = *decimal / Base;
+            trailing = begin == end or *begin < '0' or *begin > '9';
+            auto exponent = std::int64_t{};
+            for (; begin != end and *begin >= '0' and *begin <= '9'; ++begin) {
+                exponent = std::min<std::int64_t>(exponent * 10 + (*begin - '0'), 1 << 24);
             }
+            scale += negative_exponent ? -exponent : exponent;
+        }
+        trailing = not at_end() or trailing;
+
+        auto result = std::pair{number{}, std::errc()};
+        if (significant_digits == 0) {
+            result.first = number{};
+        } else if (auto const exact = _exact_fast_path(mantissa, scale);
+                   significant_digits <= max_mantissa_digits and exact.has_value()) {
+            result.first = *exact;
+        } else {
+            auto const tail_size = static_cast<std::size_t>(std::max(significant_digits - max_mantissa_digits, 0));
+            result = _correctly_rounded(mantissa, std::span{tail}.first(tail_size), sticky, scale);
         }
 
-        return make_result(res * sign);
+        if (result.second != std::errc()) {
+            return make_failure(result.second);
+        }
+        if (trailing) {
+            return make_failure(std::errc::invalid_argument);
+        }
+        return make_result(with_sign(result.first));
     }
 
 
@@ -382,6 +970,9 @@ static_assert(ston<int, 16, policy::use_exception>(std::string_view{"A"}) == 10)
 static_assert(ston<int>("12345678" | std::views::reverse) == 87654321);
 static_assert(ston<int, 16>("ABC" | std::views::reverse) == 0xCBA);
 static_assert(std::abs(ston<double>("123.456-" | std::views::reverse) - -654.321) < 0.0000001);
+static_assert(ston<int>._parse_decimal("-2147483648") == std::pair{-2147483647 - 1, std::errc()});
+static_assert(ston<int>._parse_decimal("2147483648").second == std::errc::result_out_of_range);
+static_assert(ston<std::int64_t>._parse_decimal("-000009223372036854775807").first == -9223372036854775807);
 #endif  // CB_TESTING_ON || defined CB_TESTING_FORMAT
 
 } // namespace callables
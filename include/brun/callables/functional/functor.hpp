@@ -7,11 +7,31 @@
 #ifndef CB_FUNCTIONAL_FUNCTOR_HPP
 #define CB_FUNCTIONAL_FUNCTOR_HPP
 
-#include <optional>
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <deque>
 #include <expected>
+#include <functional>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
 
+#include "../combinators.hpp"
 #include "../identity.hpp"
+#include "../detail/partial.hpp"
+#include "../detail/parallel.hpp"
 #include "../detail/_config_begin.hpp"
 
 /*
@@ -29,47 +49,97 @@ namespace callables
 {
 
 namespace _functor {
+// Calls `fn(begin, end)` on contiguous chunks of [0, size): one per thread if `Policy` allows it and each
+//  of them gets at least `min_chunk` elements, otherwise a single one on the calling thread
+template <typename Policy, typename Fn>
+constexpr void for_each_range(std::size_t size, std::size_t min_chunk, Fn fn)
+{
+    if constexpr (exec::multithreaded_policy<Policy>) {
+        // `chunk_count` asks the number of cores to the system, which costs as much as mapping thousands of
+        //  elements: it's skipped for inputs that can't be split
+        if not consteval {
+            if (size / std::max(min_chunk, std::size_t{1}) > 1) {
+                if (auto const chunks = detail::chunk_count(size, min_chunk); chunks > 1) {
+                    detail::for_each_chunk(size, chunks, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        fn(begin, end);
+                    });
+                    return;
+                }
+            }
+        }
+    }
+    fn(std::size_t{}, size);
+}
+
+// Whether the results can be assigned to the elements of a buffer of the final size: always for trivial
+//  types, which the compiler can then vectorize instead of checking the capacity at each `emplace_back`;
+//  on many threads for any type that can be default constructed, as the threads can't append. Booleans
+//  are stored as bits, so that they are always appended
+template <typename To, typename Policy>
+constexpr inline auto fmap_in_buffer = not std::same_as<To, bool> and (
+    (std::is_trivially_default_constructible_v<To> and std::is_trivially_copyable_v<To>)
+    or (exec::multithreaded_policy<Policy> and std::default_initializable<To> and std::is_move_assignable_v<To>)
+);
+
 // Overloads for `std::vector`
-template <typename Fn, typename T, typename Alloc>
-constexpr auto fmap(Fn && fn, std::vector<T, Alloc> const & from)
+// `apply(from[i])` for each element of `from`, in a new vector allocated by `alloc` rebound to `To`
+template <typename To, typename Policy = exec::sequenced_policy, typename From, typename Apply, typename Alloc>
+constexpr auto fmap_vector(From & from, Apply apply, Alloc const & alloc,
+                           std::size_t min_chunk = detail::min_elements_per_thread)
 {
-    using to_t = std::invoke_result_t<Fn &, T &>;
-    static_assert(not std::is_reference_v<to_t>, "can't create a vector of references");
-    using allocator_t = typename std::allocator_traits<Alloc>::template rebind_alloc<to_t>;
-    auto result = std::vector<to_t, allocator_t>();
-    result.reserve(from.size());
-    for (auto const & elem : from) {
-        result.emplace_back(fn(elem));
+    static_assert(not std::is_reference_v<To>, "can't create a vector of references");
+    using allocator_t = typename std::allocator_traits<Alloc>::template rebind_alloc<To>;
+    auto result = std::vector<To, allocator_t>(allocator_t(alloc));
+    if constexpr (fmap_in_buffer<To, Policy>) {
+        result.resize(from.size());
+        auto const out = result.data();
+        for_each_range<Policy>(from.size(), min_chunk, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                out[i] = apply(from[i]);
+            }
+        });
+    } else {
+        result.reserve(from.size());
+        for (auto && elem : from) {
+            result.emplace_back(apply(elem));
+        }
     }
     return result;
 }
 
 template <typename Fn, typename T, typename Alloc>
+    requires std::invocable<Fn &, T const &>
+constexpr auto fmap(Fn && fn, std::vector<T, Alloc> const & from)
+{
+    using to_t = std::invoke_result_t<Fn &, T const &>;
+    return fmap_vector<to_t>(from, [&](auto const & elem) -> to_t { return fn(elem); }, from.get_allocator());
+}
+
+template <typename Fn, typename T, typename Alloc>
+    requires std::invocable<Fn &, T &>
 constexpr auto fmap(Fn && fn, std::vector<T, Alloc> & from)
 {
     using to_t = std::invoke_result_t<Fn &, T &>;
-    static_assert(not std::is_reference_v<to_t>, "can't create a vector of references");
-    using allocator_t = typename std::allocator_traits<Alloc>::template rebind_alloc<to_t>;
-    auto result = std::vector<to_t, allocator_t>();
-    result.reserve(from.size());
-    for (auto & elem : from) {
-        result.emplace_back(fn(elem));
-    }
-    return result;
+    return fmap_vector<to_t>(from, [&](auto && elem) -> to_t { return fn(elem); }, from.get_allocator());
 }
 
+// When `fn` returns the same type, the elements are replaced in place and `from` is returned, without
+//  allocating a new buffer
 template <typename Fn, typename T, typename Alloc>
+    requires std::invocable<Fn &, T &&>
 constexpr auto fmap(Fn && fn, std::vector<T, Alloc> && from)
 {
-    using to_t = std::invoke_result_t<Fn &, T &>;
-    static_assert(not std::is_reference_v<to_t>, "can't create a vector of references");
-    using allocator_t = typename std::allocator_traits<Alloc>::template rebind_alloc<to_t>;
-    auto result = std::vector<to_t, allocator_t>();
-    result.reserve(from.size());
-    for (auto && elem : from) {
-        result.emplace_back(fn(std::move(elem)));
+    using to_t = std::invoke_result_t<Fn &, T &&>;
+    if constexpr (std::same_as<to_t, T> and std::is_move_assignable_v<T>) {
+        for (auto i = std::size_t{}; i < from.size(); ++i) {
+            from[i] = fn(std::move(from[i]));
+        }
+        return std::move(from);
+    } else {
+        return fmap_vector<to_t>(
+            from, [&](auto && elem) -> to_t { return fn(std::move(elem)); }, from.get_allocator()
+        );
     }
-    return result;
 }
 
 // Overloads for std::array
@@ -91,7 +161,356 @@ constexpr auto fmap(Fn && fn, std::array<From, N> && from)
     }(std::make_index_sequence<N>());
 }
 
+// Overloads for `std::span`: the elements are only viewed, so they are mapped into a new vector, or into the
+//  first `from.size()` elements of `out` (which must have room for them) without allocating
+template <typename Fn, typename T, std::size_t Extent>
+    requires std::invocable<Fn &, T &>
+constexpr auto fmap(Fn && fn, std::span<T, Extent> from)
+{
+    using to_t = std::invoke_result_t<Fn &, T &>;
+    return fmap_vector<to_t>(from, [&](auto && elem) -> to_t { return fn(elem); }, std::allocator<to_t>{});
+}
+
+template <typename Fn, typename T, std::size_t Extent, typename To, std::size_t OutExtent>
+    requires std::invocable<Fn &, T &> and std::assignable_from<To &, std::invoke_result_t<Fn &, T &>>
+constexpr auto fmap(Fn && fn, std::span<T, Extent> from, std::span<To, OutExtent> out) -> std::span<To>
+{
+    assert(out.size() >= from.size() && "the output span is shorter than the input one");
+    auto const in = from.data();
+    auto const dst = out.data();
+    for (auto i = std::size_t{}; i < from.size(); ++i) {
+        dst[i] = fn(in[i]);
+    }
+    return out.first(from.size());
+}
+
+#if defined __cpp_lib_mdspan
+// Calls `fn(idx...)` for each multi-index of `extents`, the last index changing fastest
+template <std::size_t Dim = 0, typename Extents, typename Fn, typename ...Idx>
+constexpr void for_each_multi_index(Extents const & extents, Fn & fn, Idx... idx)
+{
+    if constexpr (Dim == Extents::rank()) {
+        fn(idx...);
+    } else {
+        for (auto i = typename Extents::index_type{}; i < extents.extent(Dim); ++i) {
+            for_each_multi_index<Dim + 1>(extents, fn, idx..., i);
+        }
+    }
+}
+
+template <typename Layout>
+constexpr inline auto is_exhaustive_layout = std::same_as<Layout, std::layout_right>
+                                          or std::same_as<Layout, std::layout_left>;
+
+// Overload for `std::mdspan`: mapped into `out`, which must have the same extents; when both of them have the
+//  same dense layout and plain accessors, their elements are in the same order, and they're mapped in a single
+//  loop over the storage instead of one per dimension
+template <typename Fn, typename T, typename Extents, typename Layout, typename Accessor,
+          typename To, typename OutExtents, typename OutLayout, typename OutAccessor>
+    requires (Extents::rank() == OutExtents::rank())
+         and std::invocable<Fn &, typename Accessor::reference>
+         and std::assignable_from<typename OutAccessor::reference,
+                                  std::invoke_result_t<Fn &, typename Accessor::reference>>
+constexpr auto fmap(Fn && fn, std::mdspan<T, Extents, Layout, Accessor> from,
+                    std::mdspan<To, OutExtents, OutLayout, OutAccessor> out)
+{
+    assert(from.extents() == out.extents() && "the output mdspan has other extents than the input one");
+    if constexpr (std::same_as<Layout, OutLayout> and is_exhaustive_layout<Layout>
+                  and std::same_as<Accessor, std::default_accessor<T>>
+                  and std::same_as<OutAccessor, std::default_accessor<To>>) {
+        auto const in = from.data_handle();
+        auto const dst = out.data_handle();
+        for (auto i = std::size_t{}; i < from.size(); ++i) {
+            dst[i] = fn(in[i]);
+        }
+    } else {
+        auto assign = [&](auto... idx) { out[idx...] = fn(from[idx...]); };
+        for_each_multi_index(from.extents(), assign);
+    }
+    return out;
+}
+#endif
+
+// Overloads for `std::deque`: like for vectors, a deque of trivial results is sized once and then assigned,
+//  instead of checking at each element whether the last block is full, and an rvalue is transformed in place
+//  when `fn` keeps the type of the elements
+template <typename To, typename From, typename Apply, typename Alloc>
+constexpr auto fmap_deque(From & from, Apply apply, Alloc const & alloc)
+{
+    using allocator_t = typename std::allocator_traits<Alloc>::template rebind_alloc<To>;
+    auto result = std::deque<To, allocator_t>(allocator_t(alloc));
+    if constexpr (fmap_in_buffer<To, exec::sequenced_policy>) {
+        result.resize(from.size());
+        auto out = result.begin();
+        for (auto && elem : from) {
+            *out = apply(elem);
+            ++out;
+        }
+    } else {
+        for (auto && elem : from) {
+            result.emplace_back(apply(elem));
+        }
+    }
+    return result;
+}
+
+template <typename Fn, typename T, typename Alloc>
+    requires std::invocable<Fn &, T const &>
+constexpr auto fmap(Fn && fn, std::deque<T, Alloc> const & from)
+{
+    using to_t = std::invoke_result_t<Fn &, T const &>;
+    return fmap_deque<to_t>(from, [&](auto const & elem) -> to_t { return fn(elem); }, from.get_allocator());
+}
+
+template <typename Fn, typename T, typename Alloc>
+    requires std::invocable<Fn &, T &>
+constexpr auto fmap(Fn && fn, std::deque<T, Alloc> & from)
+{
+    using to_t = std::invoke_result_t<Fn &, T &>;
+    return fmap_deque<to_t>(from, [&](auto && elem) -> to_t { return fn(elem); }, from.get_allocator());
+}
+
+template <typename Fn, typename T, typename Alloc>
+    requires std::invocable<Fn &, T &&>
+constexpr auto fmap(Fn && fn, std::deque<T, Alloc> && from)
+{
+    using to_t = std::invoke_result_t<Fn &, T &&>;
+    if constexpr (std::same_as<to_t, T> and std::is_move_assignable_v<T>) {
+        for (auto & elem : from) {
+            elem = fn(std::move(elem));
+        }
+        return std::move(from);
+    } else {
+        return fmap_deque<to_t>(
+            from, [&](auto && elem) -> to_t { return fn(std::move(elem)); }, from.get_allocator()
+        );
+    }
+}
+
+// Overloads for `std::map`, `std::multimap`, `std::unordered_map` and `std::unordered_multimap`: `fn` maps
+//  the values and the keys are kept
+template <typename Alloc, typename K, typename V>
+using map_allocator_t = typename std::allocator_traits<Alloc>::template rebind_alloc<std::pair<K const, V>>;
+
+// `rebind_map<Map, To, Alloc>::type` is `Map` with values of type `To`, allocated by `Alloc` rebound to its nodes
+template <typename Map, typename To, typename OutAlloc>
+struct rebind_map {};
+
+template <typename K, typename V, typename Comp, typename Alloc, typename To, typename OutAlloc>
+struct rebind_map<std::map<K, V, Comp, Alloc>, To, OutAlloc> {
+    using type = std::map<K, To, Comp, map_allocator_t<OutAlloc, K, To>>;
+};
+
+template <typename K, typename V, typename Comp, typename Alloc, typename To, typename OutAlloc>
+struct rebind_map<std::multimap<K, V, Comp, Alloc>, To, OutAlloc> {
+    using type = std::multimap<K, To, Comp, map_allocator_t<OutAlloc, K, To>>;
+};
+
+template <typename K, typename V, typename Hash, typename Eq, typename Alloc, typename To, typename OutAlloc>
+struct rebind_map<std::unordered_map<K, V, Hash, Eq, Alloc>, To, OutAlloc> {
+    using type = std::unordered_map<K, To, Hash, Eq, map_allocator_t<OutAlloc, K, To>>;
+};
+
+template <typename K, typename V, typename Hash, typename Eq, typename Alloc, typename To, typename OutAlloc>
+struct rebind_map<std::unordered_multimap<K, V, Hash, Eq, Alloc>, To, OutAlloc> {
+    using type = std::unordered_multimap<K, To, Hash, Eq, map_allocator_t<OutAlloc, K, To>>;
+};
+
+template <typename T>
+constexpr inline auto is_map = requires { typename rebind_map<T, int, std::allocator<int>>::type; };
+
+// An empty map like `from`, with the same ordering or hash, whose values are `To`, allocated by `alloc`
+template <typename To, typename Map, typename Alloc>
+auto empty_map_like(Map const & from, Alloc const & alloc)
+{
+    using result_t = typename rebind_map<Map, To, Alloc>::type;
+    using allocator_t = typename result_t::allocator_type;
+    if constexpr (requires { from.key_comp(); }) {
+        return result_t(from.key_comp(), allocator_t(alloc));
+    } else {
+        return result_t(from.bucket_count(), from.hash_function(), from.key_eq(), allocator_t(alloc));
+    }
+}
+
+// The elements are added in the order of `from`, so that each of them goes right at the end of an ordered
+//  map and equal keys keep their order; the keys of an rvalue that aren't trivial to copy are moved out of
+//  its nodes
+template <typename To, typename Fn, typename Map, typename Alloc>
+auto fmap_map(Fn & fn, Map && from, Alloc const & alloc)
+{
+    using key_t = typename std::remove_cvref_t<Map>::key_type;
+    constexpr auto is_rvalue = not std::is_lvalue_reference_v<Map> and not std::is_const_v<Map>;
+    auto result = empty_map_like<To>(std::as_const(from), alloc);
+    if constexpr (is_rvalue and not std::is_trivially_copyable_v<key_t>) {
+        while (not from.empty()) {
+            auto node = from.extract(from.begin());
+            result.emplace_hint(result.end(), std::move(node.key()), fn(std::move(node.mapped())));
+        }
+    } else {
+        for (auto & [key, value] : from) {
+            result.emplace_hint(result.end(), key, fn(detail::forward_like<Map>(value)));
+        }
+    }
+    return result;
+}
+
+// From an rvalue, the values are replaced in place if `fn` keeps their type
+template <typename Fn, typename Map, typename Value = typename std::remove_cvref_t<Map>::mapped_type>
+    requires is_map<std::remove_cvref_t<Map>>
+         and std::invocable<Fn &, decltype(detail::forward_like<Map>(std::declval<Value &>()))>
+auto fmap(Fn && fn, Map && from)
+{
+    using value_t = decltype(detail::forward_like<Map>(std::declval<Value &>()));
+    using to_t = std::invoke_result_t<Fn &, value_t>;
+    constexpr auto is_rvalue = not std::is_lvalue_reference_v<Map> and not std::is_const_v<Map>;
+
+    if constexpr (is_rvalue and std::same_as<to_t, Value> and std::is_move_assignable_v<Value>) {
+        for (auto & [key, value] : from) {
+            value = fn(std::move(value));
+        }
+        return std::move(from);
+    } else {
+        return fmap_map<to_t>(fn, CB_FWD(from), from.get_allocator());
+    }
+}
+
+// Overloads with an output allocator: the result is allocated by `alloc` rebound to its elements (or nodes)
+//  instead of by the allocator of `from`, e.g. by a `std::pmr::polymorphic_allocator` on a monotonic buffer
+template <typename Alloc>
+concept allocator = requires(Alloc & alloc, std::size_t n) {
+    typename Alloc::value_type;
+    { alloc.allocate(n) };
+};
+
+template <typename T>
+constexpr inline auto is_vector = false;
+
+template <typename T, typename Alloc>
+constexpr inline auto is_vector<std::vector<T, Alloc>> = true;
+
+template <typename T>
+constexpr inline auto is_deque = false;
+
+template <typename T, typename Alloc>
+constexpr inline auto is_deque<std::deque<T, Alloc>> = true;
+
+template <typename Fn, typename From, allocator OutAlloc, typename Value = typename std::remove_cvref_t<From>::value_type>
+    requires (is_vector<std::remove_cvref_t<From>> or is_deque<std::remove_cvref_t<From>>)
+         and std::invocable<Fn &, decltype(detail::forward_like<From>(std::declval<Value &>()))>
+constexpr auto fmap(Fn && fn, From && from, OutAlloc const & alloc)
+{
+    using to_t = std::invoke_result_t<Fn &, decltype(detail::forward_like<From>(std::declval<Value &>()))>;
+    auto const apply = [&](auto && elem) -> to_t { return fn(detail::forward_like<From>(elem)); };
+    if constexpr (is_vector<std::remove_cvref_t<From>>) {
+        return fmap_vector<to_t>(from, apply, alloc);
+    } else {
+        return fmap_deque<to_t>(from, apply, alloc);
+    }
+}
+
+template <typename Fn, typename T, std::size_t Extent, allocator OutAlloc>
+    requires std::invocable<Fn &, T &>
+constexpr auto fmap(Fn && fn, std::span<T, Extent> from, OutAlloc const & alloc)
+{
+    using to_t = std::invoke_result_t<Fn &, T &>;
+    return fmap_vector<to_t>(from, [&](auto && elem) -> to_t { return fn(elem); }, alloc);
+}
+
+template <typename Fn, typename Map, allocator OutAlloc, typename Value = typename std::remove_cvref_t<Map>::mapped_type>
+    requires is_map<std::remove_cvref_t<Map>>
+         and std::invocable<Fn &, decltype(detail::forward_like<Map>(std::declval<Value &>()))>
+auto fmap(Fn && fn, Map && from, OutAlloc const & alloc)
+{
+    using to_t = std::invoke_result_t<Fn &, decltype(detail::forward_like<Map>(std::declval<Value &>()))>;
+    return fmap_map<to_t>(fn, CB_FWD(from), alloc);
+}
+
+// Overloads with an execution policy: with `exec::par` or `exec::par_unseq`, the elements of vectors, arrays
+//  and spans are split in contiguous chunks of at least `min_chunk` elements, mapped on different threads
+template <typename Fn, typename T, typename Alloc, exec::execution_policy Policy>
+    requires std::invocable<Fn &, T const &>
+constexpr auto fmap(Fn && fn, std::vector<T, Alloc> const & from, Policy, std::size_t min_chunk)
+{
+    using to_t = std::invoke_result_t<Fn &, T const &>;
+    return fmap_vector<to_t, Policy>(
+        from, [&](auto const & elem) -> to_t { return fn(elem); }, from.get_allocator(), min_chunk
+    );
+}
 
+template <typename Fn, typename T, typename Alloc, exec::execution_policy Policy>
+    requires std::invocable<Fn &, T &>
+constexpr auto fmap(Fn && fn, std::vector<T, Alloc> & from, Policy, std::size_t min_chunk)
+{
+    using to_t = std::invoke_result_t<Fn &, T &>;
+    return fmap_vector<to_t, Policy>(
+        from, [&](auto && elem) -> to_t { return fn(elem); }, from.get_allocator(), min_chunk
+    );
+}
+
+template <typename Fn, typename T, typename Alloc, exec::execution_policy Policy>
+    requires std::invocable<Fn &, T &&>
+constexpr auto fmap(Fn && fn, std::vector<T, Alloc> && from, Policy, std::size_t min_chunk)
+{
+    using to_t = std::invoke_result_t<Fn &, T &&>;
+    if constexpr (std::same_as<to_t, T> and std::is_move_assignable_v<T> and not std::same_as<T, bool>) {
+        for_each_range<Policy>(from.size(), min_chunk, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                from[i] = fn(std::move(from[i]));
+            }
+        });
+        return std::move(from);
+    } else {
+        return fmap_vector<to_t, Policy>(
+            from, [&](auto && elem) -> to_t { return fn(std::move(elem)); }, from.get_allocator(), min_chunk
+        );
+    }
+}
+
+template <typename Fn, typename T, std::size_t Extent, exec::execution_policy Policy>
+    requires std::invocable<Fn &, T &>
+constexpr auto fmap(Fn && fn, std::span<T, Extent> from, Policy, std::size_t min_chunk)
+{
+    using to_t = std::invoke_result_t<Fn &, T &>;
+    return fmap_vector<to_t, Policy>(
+        from, [&](auto && elem) -> to_t { return fn(elem); }, std::allocator<to_t>{}, min_chunk
+    );
+}
+
+template <typename Fn, typename From, std::size_t N, exec::execution_policy Policy>
+    requires std::invocable<Fn &, From const &>
+constexpr auto fmap(Fn && fn, std::array<From, N> const & from, Policy, std::size_t min_chunk)
+{
+    using to_t = std::invoke_result_t<Fn &, From const &>;
+    if constexpr (std::default_initializable<to_t> and std::is_move_assignable_v<to_t>) {
+        auto result = std::array<to_t, N>{};
+        for_each_range<Policy>(N, min_chunk, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                result[i] = fn(from[i]);
+            }
+        });
+        return result;
+    } else {
+        return fmap(fn, from);
+    }
+}
+
+template <typename Fn, typename From, std::size_t N, exec::execution_policy Policy>
+    requires std::invocable<Fn &, From &&>
+constexpr auto fmap(Fn && fn, std::array<From, N> && from, Policy, std::size_t min_chunk)
+{
+    using to_t = std::invoke_result_t<Fn &, From &&>;
+    if constexpr (std::default_initializable<to_t> and std::is_move_assignable_v<to_t>) {
+        auto result = std::array<to_t, N>{};
+        for_each_range<Policy>(N, min_chunk, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                result[i] = fn(std::move(from[i]));
+            }
+        });
+        return result;
+    } else {
+        return fmap(fn, std::move(from));
+    }
+}
 
 // Overloads for std::optional
 template <typename Fn, typename From>
@@ -126,19 +545,39 @@ static constexpr auto fmap(Fn && fn, std::expected<From, Err> && from) noexcept
 }
 
 // Concepts
+// `Functor` keeps its value category, so that the overloads for rvalues are considered too
 template <typename Functor, typename Fn>
-concept fmappable_free_function_with = requires(Fn const & fn, Functor f) {
-    { fmap(fn, f) };
+concept fmappable_free_function_with = requires(Fn const & fn, Functor && f) {
+    { fmap(fn, CB_FWD(f)) };
 };
 
 template <typename Functor, typename Fn>
-concept fmappable_member_function_with = requires(Fn const & fn, Functor f) {
-    { f.fmap(fn) };
+concept fmappable_member_function_with = requires(Fn const & fn, Functor && f) {
+    { CB_FWD(f).fmap(fn) };
 };
 
 template <typename Functor, typename Fn>
 concept fmappable_with = fmappable_free_function_with<Functor, Fn> or fmappable_member_function_with<Functor, Fn>;
 
+template <typename Functor, typename Fn, typename Out>
+concept fmappable_into = requires(Fn const & fn, Functor && f, Out && out) {
+    { fmap(fn, CB_FWD(f), CB_FWD(out)) };
+};
+
+template <typename Functor, typename Fn, typename Policy>
+concept fmappable_with_policy = requires(Fn const & fn, Functor && f, Policy policy, std::size_t min_chunk) {
+    { fmap(fn, CB_FWD(f), policy, min_chunk) };
+};
+
+template <typename Fn, typename Source>
+class lazy_map;
+
+template <typename T>
+constexpr inline auto is_lazy_map = false;
+
+template <typename Fn, typename Source>
+constexpr inline auto is_lazy_map<lazy_map<Fn, Source>> = true;
+
 struct fmap_fn
 {
     template <typename Fn, typename From>
@@ -161,6 +600,143 @@ struct fmap_fn
             return fmap(CB_FWD(fn), CB_FWD(from));
         }
     }
+
+    /**
+     * @brief the same map, run according to `policy`: with `exec::par` or `exec::par_unseq`, vectors, arrays
+     *  and spans are split in contiguous chunks of at least `min_chunk` elements (fewer elements are mapped
+     *  sequentially), mapped on different threads into an output of the final size, so `fn` must be safe to
+     *  call concurrently. Other functors, which can opt in with an `fmap(fn, from, policy, min_chunk)`
+     *  overload, and constant evaluation map sequentially
+     */
+    template <typename Fn, typename From, exec::execution_policy Policy>
+        requires fmappable_with<From, Fn> or fmappable_with_policy<From, Fn, Policy>
+    static constexpr auto operator()(Fn && fn, From && from, Policy policy,
+                                     std::size_t min_chunk = detail::min_elements_per_thread) -> decltype(auto)
+    {
+        if constexpr (fmappable_with_policy<From, Fn, Policy>) {
+            return fmap(CB_FWD(fn), CB_FWD(from), policy, min_chunk);
+        } else {
+            return fmap_fn{}(CB_FWD(fn), CB_FWD(from));
+        }
+    }
+
+    /**
+     * @brief maps `from` into `out`: without allocating, a span into the first `from.size()` elements of a span
+     *  (returning the part of `out` that was written) or an mdspan into an mdspan with the same extents; with an
+     *  allocator, vectors, deques, spans and maps into a container allocated by it
+     */
+    template <typename Fn, typename From, typename Out>
+        requires (not exec::execution_policy<Out>) and fmappable_into<From, Fn, Out>
+    static constexpr auto operator()(Fn && fn, From && from, Out && out) -> decltype(auto)
+    {
+        return fmap(CB_FWD(fn), CB_FWD(from), CB_FWD(out));
+    }
+
+    // `fmap(fn, from, resource)` allocates the result through a `std::pmr::polymorphic_allocator` on `resource`
+    template <typename Fn, typename From>
+        requires fmappable_into<From, Fn, std::pmr::polymorphic_allocator<>>
+    static constexpr auto operator()(Fn && fn, From && from, std::pmr::memory_resource * resource)
+    {
+        return fmap(CB_FWD(fn), CB_FWD(from), std::pmr::polymorphic_allocator<>(resource));
+    }
+
+    // `fmap.par(fn, from, min_chunk)` is `fmap(fn, from, exec::par, min_chunk)`
+    struct par_fn
+    {
+        template <typename Fn, typename From>
+        static constexpr auto operator()(Fn && fn, From && from, std::size_t min_chunk = detail::min_elements_per_thread)
+            -> decltype(auto)
+        {
+            return fmap_fn{}(CB_FWD(fn), CB_FWD(from), exec::par, min_chunk);
+        }
+    };
+
+    static constexpr par_fn par{};
+
+    // `fmap.lazy(fn, from)` maps nothing until `eval()` or `to<Container>()` is called on the result, and
+    //  mapping it again composes the functions, so that a chain of maps traverses `from` only once
+    struct lazy_fn
+    {
+        template <typename Fn, typename From>
+            requires fmappable_with<From, Fn>
+        static constexpr auto operator()(Fn && fn, From && from)
+        {
+            if constexpr (is_lazy_map<std::remove_cvref_t<From>>) {
+                return CB_FWD(from).fmap(CB_FWD(fn));
+            } else {
+                return lazy_map<std::decay_t<Fn>, From>{CB_FWD(fn), CB_FWD(from)};
+            }
+        }
+    };
+
+    static constexpr lazy_fn lazy{};
+};
+
+/**
+ * @brief `fn` mapped over `Source`, not applied yet. `Source` is a reference to a functor that the map
+ *  borrows, or the type of a functor it owns; mapping it again composes the functions instead of mapping
+ *  `Source`, which is only done by `eval()` (or `to<Container>()`), allocating a single result
+ */
+template <typename Fn, typename Source>
+class lazy_map
+{
+    [[no_unique_address]] Fn _fn;
+    Source _source;
+
+public:
+    template <typename F, typename S>
+    constexpr lazy_map(F && fn, S && source) : _fn(CB_FWD(fn)), _source(CB_FWD(source)) {}
+
+    template <typename G>
+    constexpr auto fmap(G && fn) const & -> lazy_map<decltype(compose(CB_FWD(fn), _fn)), Source>
+    {
+        return {compose(CB_FWD(fn), _fn), _source};
+    }
+
+    template <typename G>
+    constexpr auto fmap(G && fn) && -> lazy_map<decltype(compose(CB_FWD(fn), std::move(_fn))), Source>
+    {
+        return {compose(CB_FWD(fn), std::move(_fn)), static_cast<Source &&>(_source)};
+    }
+
+    // an owned source is moved into the map, so that a vector mapped to its own type keeps its buffer
+    constexpr auto eval() const & -> decltype(auto) { return fmap_fn{}(_fn, _source); }
+    constexpr auto eval() && -> decltype(auto) { return fmap_fn{}(std::move(_fn), static_cast<Source &&>(_source)); }
+
+    // `eval(args...)` is `fmap(fn, source, args...)`, e.g. with an execution policy or an output allocator
+    template <typename Arg, typename ...Args>
+    constexpr auto eval(Arg && arg, Args &&... args) const & -> decltype(auto)
+    {
+        return fmap_fn{}(_fn, _source, CB_FWD(arg), CB_FWD(args)...);
+    }
+
+    template <typename Arg, typename ...Args>
+    constexpr auto eval(Arg && arg, Args &&... args) && -> decltype(auto)
+    {
+        return fmap_fn{}(std::move(_fn), static_cast<Source &&>(_source), CB_FWD(arg), CB_FWD(args)...);
+    }
+
+    // `eval()` if it gives a `Container`, otherwise `Container` built from the mapped elements of a range
+    template <typename Container>
+    constexpr auto to() const & -> Container
+    {
+        if constexpr (std::same_as<decltype(eval()), Container>) {
+            return eval();
+        } else {
+            auto mapped = std::views::transform(_source, std::cref(_fn));
+            return Container(std::ranges::begin(mapped), std::ranges::end(mapped));
+        }
+    }
+
+    template <typename Container>
+    constexpr auto to() && -> Container
+    {
+        if constexpr (std::same_as<decltype(std::move(*this).eval()), Container>) {
+            return std::move(*this).eval();
+        } else {
+            return std::as_const(*this).template to<Container>();
+        }
+    }
 };
 
 }  // namespace functor
@@ -0,0 +1,353 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Sunday Oct 18, 2026 03:02:45 CEST
+ * @description : conjunction, disjunction and negation of predicates, evaluated cheapest and most decisive first
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_PREDICATES_HPP
+#define CB_PREDICATES_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "detail/functional.hpp"
+#include "detail/partial.hpp"
+#include "detail/_config_begin.hpp"
+
+namespace callables
+{
+
+// predicate_cost
+// predicate_selectivity
+// hint
+// conjunction
+// disjunction
+// negation
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...............................PREDICATE HINTS.............................. //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// How long a call to the predicate takes, relative to the comparison of two integers; other types can
+//  opt in with a `static constexpr double cost` member
+template <typename T>
+constexpr inline double predicate_cost = 1.;
+
+template <typename T>
+    requires requires() { { T::cost } -> std::convertible_to<double>; }
+constexpr inline double predicate_cost<T> = static_cast<double>(T::cost);
+
+// The fraction of the arguments that satisfy the predicate, `0.5` if unknown; other types can opt in
+//  with a `static constexpr double selectivity` member
+template <typename T>
+constexpr inline double predicate_selectivity = .5;
+
+template <typename T>
+    requires requires() { { T::selectivity } -> std::convertible_to<double>; }
+constexpr inline double predicate_selectivity<T> = static_cast<double>(T::selectivity);
+
+namespace detail
+{
+// The combinations of predicates, which the logical operators combine further
+struct predicate_expression_tag {};
+
+template <typename T>
+concept predicate_expression = std::derived_from<std::remove_cvref_t<T>, predicate_expression_tag>;
+
+// Classes with their own `operator bool` (`std::optional`, smart pointers, `std::function`, ...) keep the built-in
+//  logical operators. `std::constructible_from<bool, T>` would be too strict: captureless lambdas convert to `bool`
+//  through their function pointer
+template <typename T>
+concept predicate_operand = std::is_class_v<std::remove_cvref_t<T>>
+                        and not requires(std::remove_cvref_t<T> const & t) { t.operator bool(); };
+}  // namespace detail
+
+/**
+ * @brief `hint<Cost, Selectivity>(pred)` behaves as `pred`, with the given `predicate_cost` and
+ *  `predicate_selectivity`, which `conjunction` and `disjunction` use to choose which predicate to
+ *  evaluate first
+ */
+template <double Cost, double Selectivity>
+struct hint_fn
+{
+    template <typename Pred>
+    struct hinted : detail::predicate_expression_tag
+    {
+        static constexpr double cost = Cost;
+        static constexpr double selectivity = Selectivity;
+
+        [[no_unique_address]] Pred _pred;
+
+        template <typename ...Args>
+            requires std::predicate<Pred const &, Args...>
+        constexpr auto operator()(Args &&... args) const -> bool
+        {
+            return static_cast<bool>(std::invoke(_pred, CB_FWD(args)...));
+        }
+    };
+
+    template <typename Pred>
+    [[nodiscard]] constexpr static auto operator()(Pred && pred)
+    {
+        return hinted<std::remove_cvref_t<Pred>>{{}, CB_FWD(pred)};
+    }
+};
+
+template <double Cost, double Selectivity = .5>
+    requires (Cost >= 0. and Selectivity >= 0. and Selectivity <= 1.)
+constexpr inline hint_fn<Cost, Selectivity> hint;
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..........................CONJUNCTION, DISJUNCTION.......................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+namespace detail
+{
+// `Clauses` in the order they are evaluated: all of them must hold if `Conjunction`, any of them otherwise.
+//  Its cost is the expected cost of the evaluation, stopping at the first clause that decides the result,
+//  and the clauses are assumed independent of each other
+template <bool Conjunction, typename ...Clauses>
+struct junction : predicate_expression_tag
+{
+    static constexpr bool is_conjunction = Conjunction;
+    static constexpr double cost = [] {
+        auto total = 0.;
+        auto reached = 1.;  // the probability that a clause is evaluated
+        ((total += reached * predicate_cost<Clauses>,
+          reached *= Conjunction ? predicate_selectivity<Clauses> : 1. - predicate_selectivity<Clauses>), ...);
+        return total;
+    }();
+    static constexpr double selectivity = Conjunction
+        ? (1. * ... * predicate_selectivity<Clauses>)
+        : 1. - (1. * ... * (1. - predicate_selectivity<Clauses>));
+
+    [[no_unique_address]] std::tuple<Clauses...> _clauses;
+
+    template <typename ...Args>
+        requires (std::predicate<Clauses const &, Args &...> and ...)
+    constexpr auto operator()(Args &&... args) const -> bool
+    {
+        return [&]<std::size_t ...Idxs>(std::index_sequence<Idxs...>) {
+            if constexpr (Conjunction) {
+                return (static_cast<bool>(std::invoke(std::get<Idxs>(_clauses), args...)) and ...);
+            } else {
+                return (static_cast<bool>(std::invoke(std::get<Idxs>(_clauses), args...)) or ...);
+            }
+        }(std::index_sequence_for<Clauses...>{});
+    }
+};
+
+template <typename T, bool Conjunction> constexpr inline auto is_junction = false;
+template <bool Conjunction, typename ...Clauses>
+constexpr inline auto is_junction<junction<Conjunction, Clauses...>, Conjunction> = true;
+
+template <typename T>
+concept any_junction = is_junction<T, true> or is_junction<T, false>;
+
+// The clauses of `pred` that a junction of the same kind takes over: its own, or `pred` itself
+template <bool Conjunction, typename Pred>
+constexpr auto junction_clauses(Pred && pred)
+{
+    if constexpr (is_junction<std::remove_cvref_t<Pred>, Conjunction>) {
+        return detail::forward_like<Pred>(pred._clauses);
+    } else {
+        return std::tuple<std::remove_cvref_t<Pred>>{CB_FWD(pred)};
+    }
+}
+
+// Clauses go first the more likely they are to decide the result for what they cost: those that fail most
+//  often in a conjunction, and those that hold most often in a disjunction. Clauses that never decide it
+//  go last, and equivalent clauses keep their order
+template <bool Conjunction, typename ...Clauses>
+consteval auto junction_order()
+{
+    constexpr auto size = sizeof...(Clauses);
+    auto const rank = [](double cost, double selectivity) {
+        auto const deciding = Conjunction ? 1. - selectivity : selectivity;
+        return deciding > 0. ? cost / deciding : std::numeric_limits<double>::infinity();
+    };
+    auto const ranks = std::array<double, size>{rank(predicate_cost<Clauses>, predicate_selectivity<Clauses>)...};
+    auto order = std::array<std::size_t, size>{};
+    for (auto i = std::size_t{}; i < size; ++i) {
+        auto j = i;
+        for (; j > 0 and ranks[order[j - 1]] > ranks[i]; --j) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+    return order;
+}
+
+template <bool Conjunction, typename ...Clauses>
+constexpr auto make_junction(std::tuple<Clauses...> && clauses)
+{
+    return [&]<std::size_t ...Idxs>(std::index_sequence<Idxs...>) {
+        constexpr auto order = junction_order<Conjunction, Clauses...>();
+        using tuple = std::tuple<Clauses...>;
+        return junction<Conjunction, std::tuple_element_t<order[Idxs], tuple>...>{
+            {}, {std::get<order[Idxs]>(std::move(clauses))...}
+        };
+    }(std::index_sequence_for<Clauses...>{});
+}
+
+template <bool Conjunction>
+struct junction_fn
+{
+    template <typename ...Preds>
+        requires (sizeof...(Preds) > 0)
+    [[nodiscard]] constexpr static auto operator()(Preds &&... preds)
+    {
+        return make_junction<Conjunction>(std::tuple_cat(junction_clauses<Conjunction>(CB_FWD(preds))...));
+    }
+};
+}  // namespace detail
+
+/**
+ * @brief `conjunction(preds...)` holds for the arguments that satisfy all of `preds`. Nested conjunctions are
+ *  flattened, and the predicates are evaluated in order of `predicate_cost` over the fraction of arguments
+ *  that fail them (see `hint`), stopping at the first that fails; predicates without hints keep their order.
+ *  Empty predicates make an empty conjunction
+ */
+using conjunction_fn = detail::junction_fn<true>;
+constexpr inline conjunction_fn conjunction;
+
+/**
+ * @brief `disjunction(preds...)` holds for the arguments that satisfy any of `preds`; like `conjunction`,
+ *  the predicates more likely to hold for what they cost are evaluated first
+ */
+using disjunction_fn = detail::junction_fn<false>;
+constexpr inline disjunction_fn disjunction;
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ..................................NEGATION.................................. //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+namespace detail
+{
+template <typename Pred>
+struct negated : predicate_expression_tag
+{
+    static constexpr double cost = predicate_cost<Pred>;
+    static constexpr double selectivity = 1. - predicate_selectivity<Pred>;
+
+    [[no_unique_address]] Pred _pred;
+
+    template <typename ...Args>
+        requires std::predicate<Pred const &, Args...>
+    constexpr auto operator()(Args &&... args) const -> bool
+    {
+        return not static_cast<bool>(std::invoke(_pred, CB_FWD(args)...));
+    }
+};
+
+template <typename T> constexpr inline auto is_negated = false;
+template <typename Pred> constexpr inline auto is_negated<negated<Pred>> = true;
+}  // namespace detail
+
+/**
+ * @brief `negation(pred)` holds for the arguments that do not satisfy `pred`; the negation of a negation
+ *  is the original predicate, and the negation of a conjunction (disjunction) is the disjunction
+ *  (conjunction) of the negations, in the same order
+ */
+struct negation_fn
+{
+    template <typename Pred>
+    [[nodiscard]] constexpr static auto operator()(Pred && pred)
+    {
+        using pred_t = std::remove_cvref_t<Pred>;
+        if constexpr (detail::is_negated<pred_t>) {
+            return detail::forward_like<Pred>(pred._pred);
+        } else if constexpr (detail::any_junction<pred_t>) {
+            return std::apply([](auto &&... clauses) {
+                return detail::junction<not pred_t::is_conjunction, decltype(negation_fn{}(CB_FWD(clauses)))...>{
+                    {}, {negation_fn{}(CB_FWD(clauses))...}
+                };
+            }, detail::forward_like<Pred>(pred._clauses));
+        } else {
+            return detail::negated<std::remove_cvref_t<Pred>>{{}, CB_FWD(pred)};
+        }
+    }
+};
+
+constexpr inline negation_fn negation;
+
+// `and`, `or` and `not` combine the predicate expressions above with any other predicate; the operators in
+//  `callables::operators` combine any two predicates
+template <typename L, typename R>
+    requires (detail::predicate_expression<L> or detail::predicate_expression<R>)
+        and detail::predicate_operand<L> and detail::predicate_operand<R>
+[[nodiscard]] constexpr auto operator and(L && lhs, R && rhs)
+{
+    return conjunction(CB_FWD(lhs), CB_FWD(rhs));
+}
+
+template <typename L, typename R>
+    requires (detail::predicate_expression<L> or detail::predicate_expression<R>)
+        and detail::predicate_operand<L> and detail::predicate_operand<R>
+[[nodiscard]] constexpr auto operator or(L && lhs, R && rhs)
+{
+    return disjunction(CB_FWD(lhs), CB_FWD(rhs));
+}
+
+template <detail::predicate_expression Pred>
+[[nodiscard]] constexpr auto operator not(Pred && pred)
+{
+    return negation(CB_FWD(pred));
+}
+
+namespace operators
+{
+template <detail::callable L, detail::callable R>
+    requires (not detail::predicate_expression<L> and not detail::predicate_expression<R>)
+        and detail::predicate_operand<L> and detail::predicate_operand<R>
+[[nodiscard]] constexpr auto operator and(L && lhs, R && rhs)
+{
+    return conjunction(CB_FWD(lhs), CB_FWD(rhs));
+}
+
+template <detail::callable L, detail::callable R>
+    requires (not detail::predicate_expression<L> and not detail::predicate_expression<R>)
+        and detail::predicate_operand<L> and detail::predicate_operand<R>
+[[nodiscard]] constexpr auto operator or(L && lhs, R && rhs)
+{
+    return disjunction(CB_FWD(lhs), CB_FWD(rhs));
+}
+
+template <detail::callable Pred>
+    requires (not detail::predicate_expression<Pred>) and detail::predicate_operand<Pred>
+[[nodiscard]] constexpr auto operator not(Pred && pred)
+{
+    return negation(CB_FWD(pred));
+}
+}  // namespace operators
+
+} // namespace callables
+
+#include "detail/_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_PREDICATES_HPP */
@@ -0,0 +1,315 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Sunday Oct 18, 2026 01:37:52 CEST
+ * @description : batched evaluation of predicates over contiguous ranges
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_SIMD_HPP
+#define CB_SIMD_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "comparison.hpp"
+#include "identity.hpp"
+#include "math.hpp"
+#include "ordering.hpp"
+#include "detail/functional.hpp"
+#include "detail/partial.hpp"
+
+#include "detail/_config_begin.hpp"
+namespace callables
+{
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...........................BATCHED PREDICATES............................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+namespace detail
+{
+template <typename Cmp>
+concept comparison_fn = std::same_as<Cmp, less_fn> or std::same_as<Cmp, less_equal_fn>
+    or std::same_as<Cmp, greater_fn> or std::same_as<Cmp, greater_equal_fn>
+    or std::same_as<Cmp, equal_to_fn> or std::same_as<Cmp, not_equal_to_fn>;
+
+// `v cmp x` is `x mirrored_t<cmp> v`
+template <comparison_fn Cmp> struct mirrored                { using type = Cmp;              };
+template <> struct mirrored<less_fn>                        { using type = greater_fn;       };
+template <> struct mirrored<less_equal_fn>                  { using type = greater_equal_fn; };
+template <> struct mirrored<greater_fn>                     { using type = less_fn;          };
+template <> struct mirrored<greater_equal_fn>               { using type = less_equal_fn;    };
+
+// The comparison `pred(x)` makes between `x` and its bound value, if it is a bound comparison
+template <typename Pred> struct bound_comparison {};
+template <comparison_fn Cmp, typename T>
+struct bound_comparison<right_partial<Cmp, T>> { using type = Cmp; };
+template <comparison_fn Cmp, typename T>
+struct bound_comparison<partial<Cmp, T>> { using type = typename mirrored<Cmp>::type; };
+
+template <typename Pred>
+using bound_comparison_t = typename bound_comparison<Pred>::type;
+
+template <typename Pred> constexpr inline auto between_capture = false;
+template <typename Lower, typename Higher>
+constexpr inline auto between_capture<between_fn::capture<Lower, Higher>> = true;
+
+// The integers `x` for which `lo <= x <= hi` holds, or for which it does not if `negated`. Any comparison
+//  between an integer `x` and a bound integer (of any type) is one of these, with the bound converted to
+//  `X` once: `Bounds` tells which bounds are checked, so that each element takes a single vector compare,
+//  and no branch. An `empty` interval selects no element, or every one if `negated`, and is not checked
+//  element by element
+enum class interval_bounds { lower, upper, both, equal };
+
+template <numeric X, interval_bounds Bounds>
+struct integer_interval
+{
+    static constexpr auto min = std::numeric_limits<X>::min();
+    static constexpr auto max = std::numeric_limits<X>::max();
+
+    X lo;
+    X hi;
+    bool negated;
+    bool empty;
+
+    // `[lo, hi]`, clamped to the values of `X`
+    template <numeric Lower, numeric Higher>
+    static constexpr auto closed(Lower lo, Higher hi, bool negated = false) noexcept -> integer_interval
+    {
+        if (std::cmp_greater(lo, hi) or std::cmp_greater(lo, max) or std::cmp_less(hi, min)) {
+            return {min, max, negated, true};
+        }
+        return {
+            std::cmp_less(lo, min) ? min : static_cast<X>(lo),
+            std::cmp_greater(hi, max) ? max : static_cast<X>(hi),
+            negated,
+            false
+        };
+    }
+
+    // only the `equal` intervals are ever `negated` and not `empty`
+    constexpr auto operator()(X x) const noexcept -> bool
+    {
+        if constexpr (Bounds == interval_bounds::lower) {
+            return x >= lo;
+        } else if constexpr (Bounds == interval_bounds::upper) {
+            return x <= hi;
+        } else if constexpr (Bounds == interval_bounds::equal) {
+            return (x == lo) != negated;
+        } else {
+            using unsigned_t = std::make_unsigned_t<X>;  // `lo <= x <= hi` as a single (unsigned) compare
+            return static_cast<unsigned_t>(static_cast<unsigned_t>(x) - static_cast<unsigned_t>(lo))
+                <= static_cast<unsigned_t>(static_cast<unsigned_t>(hi) - static_cast<unsigned_t>(lo));
+        }
+    }
+};
+
+template <typename Test> constexpr inline auto is_integer_interval = false;
+template <typename X, interval_bounds Bounds>
+constexpr inline auto is_integer_interval<integer_interval<X, Bounds>> = true;
+
+// The `x`s of type `X` for which `Cmp{}(x, v)`
+template <numeric X, comparison_fn Cmp, numeric V>
+constexpr auto compared_interval(V v) noexcept
+{
+    constexpr auto min = std::numeric_limits<X>::min();
+    constexpr auto max = std::numeric_limits<X>::max();
+    if constexpr (std::same_as<Cmp, less_fn>) {
+        using interval = integer_interval<X, interval_bounds::upper>;
+        return std::cmp_less_equal(v, min) ? interval::closed(max, min)
+             : interval::closed(min, std::cmp_greater(v, max) ? max : static_cast<X>(static_cast<X>(v) - 1));
+    } else if constexpr (std::same_as<Cmp, less_equal_fn>) {
+        return integer_interval<X, interval_bounds::upper>::closed(min, v);
+    } else if constexpr (std::same_as<Cmp, greater_fn>) {
+        using interval = integer_interval<X, interval_bounds::lower>;
+        return std::cmp_greater_equal(v, max) ? interval::closed(max, min)
+             : interval::closed(std::cmp_less(v, min) ? min : static_cast<X>(static_cast<X>(v) + 1), max);
+    } else if constexpr (std::same_as<Cmp, greater_equal_fn>) {
+        return integer_interval<X, interval_bounds::lower>::closed(v, max);
+    } else {
+        return integer_interval<X, interval_bounds::equal>::closed(v, v, std::same_as<Cmp, not_equal_to_fn>);
+    }
+}
+
+template <typename Pred, typename X>
+concept integer_bound_comparison = numeric<X> and requires(Pred const & pred) {
+    typename bound_comparison_t<Pred>;
+    requires numeric<std::remove_cvref_t<decltype(pred.bound())>>;
+};
+
+template <typename Pred, typename X>
+concept integer_between = numeric<X> and between_capture<Pred> and requires(Pred const & pred) {
+    requires numeric<std::remove_cvref_t<decltype(pred.lo)>> and numeric<std::remove_cvref_t<decltype(pred.hi)>>;
+};
+
+// What `simd::eval` calls on each element of type `X` in place of `pred`: bound comparisons and `between`
+//  on integers become an `integer_interval`, any other predicate is called as it is
+template <typename X, typename Pred>
+constexpr auto batch_predicate(Pred const & pred) noexcept
+{
+    if constexpr (integer_bound_comparison<Pred, X>) {
+        return compared_interval<X, bound_comparison_t<Pred>>(pred.bound());
+    } else if constexpr (integer_between<Pred, X>) {
+        return integer_interval<X, interval_bounds::both>::closed(pred.lo, pred.hi);
+    } else {
+        return [&pred](auto const & x) -> bool { return static_cast<bool>(std::invoke(pred, x)); };
+    }
+}
+
+// Whether a `batch_predicate` selects every element, none of them, or it must be called on each one
+enum class batch_uniformity : std::uint8_t { none, all, each };
+
+template <typename Test>
+constexpr auto uniformity(Test const & test) noexcept -> batch_uniformity
+{
+    if constexpr (is_integer_interval<Test>) {
+        if (test.empty) {
+            return test.negated ? batch_uniformity::all : batch_uniformity::none;
+        }
+    }
+    return batch_uniformity::each;
+}
+}  // namespace detail
+
+namespace simd
+{
+/**
+ * @brief evaluates `pred(proj(x))` for every element `x` of a contiguous range at once, writing the results
+ *  to `mask` (one byte, `0` or `1`, per element) or to `bits` (bit `i % 64` of `bits[i / 64]` for the
+ *  element `i`, with the bits past the end of the range set to zero), and returns how many elements
+ *  satisfy the predicate. The loops do not branch, so that the compiler can vectorize them; comparisons
+ *  with a bound value (e.g. `less_than(10)`, `equal_to.left(x)`, `greater_equal.right<0>()`) and `between`
+ *  on integers take a single vector compare per element, whatever the type of the bound values.
+ *  `mask` must have room for the whole range, and `bits` for `ceil(size / 64)` words
+ */
+struct eval_fn
+{
+    template <
+        std::ranges::contiguous_range Rng, typename Proj = identity_fn,
+        std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<Rng>, Proj>> Pred
+    >
+        requires std::ranges::sized_range<Rng>
+    constexpr static auto operator()(Pred const & pred, Rng && rng, std::span<std::uint8_t> mask, Proj proj = {})
+        -> std::size_t
+    {
+        auto const data = std::ranges::data(rng);
+        auto const size = std::ranges::size(rng);
+        auto const test = _predicate<Rng, Proj>(pred);
+        if (auto const uniform = detail::uniformity(test); uniform != detail::batch_uniformity::each) {
+            auto const all = uniform == detail::batch_uniformity::all;
+            std::ranges::fill_n(mask.data(), static_cast<std::ptrdiff_t>(size), static_cast<std::uint8_t>(all));
+            return all ? size : 0;
+        }
+        auto count = std::size_t{};
+        for (auto i = std::size_t{}; i < size; ++i) {
+            auto const selected = static_cast<std::uint8_t>(test(std::invoke(proj, data[i])));
+            mask[i] = selected;
+            count += selected;
+        }
+        return count;
+    }
+
+    template <
+        std::ranges::contiguous_range Rng, typename Proj = identity_fn,
+        std::indirect_unary_predicate<std::projected<std::ranges::iterator_t<Rng>, Proj>> Pred
+    >
+        requires std::ranges::sized_range<Rng>
+    constexpr static auto operator()(Pred const & pred, Rng && rng, std::span<std::uint64_t> bits, Proj proj = {})
+        -> std::size_t
+    {
+        auto const data = std::ranges::data(rng);
+        auto const size = std::ranges::size(rng);
+        auto const test = _predicate<Rng, Proj>(pred);
+        auto const words = (size + 63) / 64;
+        if (auto const uniform = detail::uniformity(test); uniform != detail::batch_uniformity::each) {
+            auto const all = uniform == detail::batch_uniformity::all;
+            std::ranges::fill_n(bits.data(), static_cast<std::ptrdiff_t>(words), all ? ~std::uint64_t{} : 0);
+            if (all and size % 64 != 0) {
+                bits[words - 1] = (std::uint64_t{1} << (size % 64)) - 1;
+            }
+            return all ? size : 0;
+        }
+        auto count = std::size_t{};
+        for (auto first = std::size_t{}; first < size; first += 64) {
+            auto const block = std::min<std::size_t>(size - first, 64);
+            // the results are first computed as bytes, which vectorizes as `mask` does, then packed 8 by 8
+            std::uint8_t selected[64] = {};
+            for (auto i = std::size_t{}; i < block; ++i) {
+                selected[i] = static_cast<std::uint8_t>(test(std::invoke(proj, data[first + i])));
+            }
+            auto const word = _pack(selected);
+            bits[first / 64] = word;
+            count += static_cast<std::size_t>(std::popcount(word));
+        }
+        return count;
+    }
+
+private:
+    template <typename Rng, typename Proj, typename Pred>
+    static constexpr auto _predicate(Pred const & pred) noexcept
+    {
+        using projected_t = std::invoke_result_t<Proj &, std::ranges::range_reference_t<Rng>>;
+        return detail::batch_predicate<std::remove_cvref_t<projected_t>>(pred);
+    }
+
+    // bit `i` of the result is `selected[i]`, which is either `0` or `1`
+    static constexpr auto _pack(std::uint8_t const (&selected)[64]) noexcept -> std::uint64_t
+    {
+        auto word = std::uint64_t{};
+        if constexpr (std::endian::native == std::endian::little) {
+            if (not std::is_constant_evaluated()) {
+                // the multiplication moves the lowest bit of each of the 8 bytes of `chunk` to the highest byte
+                for (auto k = 0; k < 8; ++k) {
+                    auto chunk = std::uint64_t{};
+                    std::memcpy(&chunk, selected + 8 * k, sizeof(chunk));
+                    word |= ((chunk * 0x0102040810204080ull) >> 56) << (8 * k);
+                }
+                return word;
+            }
+        }
+        for (auto i = 0; i < 64; ++i) {
+            word |= static_cast<std::uint64_t>(selected[i]) << i;
+        }
+        return word;
+    }
+};
+
+constexpr inline eval_fn eval;
+}  // namespace simd
+
+} // namespace callables
+
+#include "detail/_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_SIMD_HPP */
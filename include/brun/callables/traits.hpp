@@ -0,0 +1,168 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 18:05:37 CEST
+ * @description : algebraic properties of the operators, for the algorithms that reorder operations
+ * @license     :
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer,
+ * must be included in all copies of the Software, in whole or in part, and
+ * all derivative works of the Software, unless such copies or derivative
+ * works are solely in the form of machine-executable object code generated by
+ * a source language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * */
+
+#ifndef CB_TRAITS_HPP
+#define CB_TRAITS_HPP
+
+#include <concepts>
+#include <type_traits>
+#include "arithmetic.hpp"
+#include "bit_operators.hpp"
+#include "logical.hpp"
+#include "detail/_config_begin.hpp"
+
+namespace callables
+{
+
+// is_associative
+// is_commutative
+// monoid_traits
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...............................IS_ASSOCIATIVE............................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// Operations that algorithms may regroup, i.e. `op(op(a, b), c) == op(a, op(b, c))`; other
+//  types can opt in with a `static constexpr bool is_associative = true` member
+template <typename T>
+constexpr inline auto is_associative = false;
+
+template <typename T>
+    requires requires() { { T::is_associative } -> std::convertible_to<bool>; }
+constexpr inline auto is_associative<T> = static_cast<bool>(T::is_associative);
+
+template <> constexpr inline auto is_associative<plus_fn> = true;
+template <> constexpr inline auto is_associative<multiplies_fn> = true;
+template <> constexpr inline auto is_associative<bit_and_fn> = true;
+template <> constexpr inline auto is_associative<bit_or_fn> = true;
+template <> constexpr inline auto is_associative<bit_xor_fn> = true;
+template <> constexpr inline auto is_associative<logical_and_fn> = true;
+template <> constexpr inline auto is_associative<logical_or_fn> = true;
+template <> constexpr inline auto is_associative<logical_xor_fn> = true;
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...............................IS_COMMUTATIVE............................... //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// Operations whose arguments algorithms may also swap, i.e. `op(a, b) == op(b, a)` when applied
+//  to arithmetic types; other types can opt in with an `is_commutative` member
+template <typename T>
+constexpr inline auto is_commutative = false;
+
+template <typename T>
+    requires requires() { { T::is_commutative } -> std::convertible_to<bool>; }
+constexpr inline auto is_commutative<T> = static_cast<bool>(T::is_commutative);
+
+template <> constexpr inline auto is_commutative<plus_fn> = true;
+template <> constexpr inline auto is_commutative<multiplies_fn> = true;
+template <> constexpr inline auto is_commutative<bit_and_fn> = true;
+template <> constexpr inline auto is_commutative<bit_or_fn> = true;
+template <> constexpr inline auto is_commutative<bit_xor_fn> = true;
+template <> constexpr inline auto is_commutative<logical_and_fn> = true;
+template <> constexpr inline auto is_commutative<logical_or_fn> = true;
+template <> constexpr inline auto is_commutative<logical_xor_fn> = true;
+
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+// ...............................MONOID_TRAITS................................ //
+// ....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.... //
+/**
+ * @brief describes `Op` as an associative operation on `T` with an identity element, i.e.
+ *  `op(identity(), t) == op(t, identity()) == t`; `is_commutative` tells if the operands can
+ *  be swapped too. Empty unless specialized
+ */
+template <typename Op, typename T>
+struct monoid_traits {};
+
+template <typename Op, typename T>
+concept monoid = is_associative<Op> and requires {
+    { monoid_traits<Op, T>::identity() } -> std::convertible_to<T>;
+    { monoid_traits<Op, T>::is_commutative } -> std::convertible_to<bool>;
+};
+
+template <typename T>
+    requires std::is_arithmetic_v<T> and (not std::same_as<T, bool>)
+struct monoid_traits<plus_fn, T>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> T { return T{0}; }
+};
+
+template <typename T>
+    requires std::is_arithmetic_v<T> and (not std::same_as<T, bool>)
+struct monoid_traits<multiplies_fn, T>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> T { return T{1}; }
+};
+
+template <std::integral T>
+struct monoid_traits<bit_and_fn, T>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> T { return static_cast<T>(~T{}); }
+};
+
+template <std::integral T>
+struct monoid_traits<bit_or_fn, T>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> T { return T{}; }
+};
+
+template <std::integral T>
+struct monoid_traits<bit_xor_fn, T>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> T { return T{}; }
+};
+
+template <>
+struct monoid_traits<logical_and_fn, bool>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> bool { return true; }
+};
+
+template <>
+struct monoid_traits<logical_or_fn, bool>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> bool { return false; }
+};
+
+template <>
+struct monoid_traits<logical_xor_fn, bool>
+{
+    static constexpr auto is_commutative = true;
+    [[nodiscard]] static constexpr auto identity() noexcept -> bool { return false; }
+};
+
+}  // namespace callables
+
+#include "detail/_config_end.hpp"  // IWYU pragma: export
+#endif /* CB_TRAITS_HPP */
@@ -0,0 +1,262 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 17:41:20 CEST
+ * @description : 
+ */
+
+#include <brun/callables/actions.hpp>
+#define BOOST_UT_DISABLE_MODULE
+#include "boost/ut.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cb = callables;
+
+// here, unlike in `main`, the pipe operator of boost::ut is not visible
+constexpr auto piped = [](auto const & rng, auto const & action) { return rng | action; };
+
+int main()
+{
+    using namespace boost::ut;
+    using namespace boost::ut::bdd;
+    using namespace boost::ut::operators;
+    using namespace boost::ut::operators::terse;
+
+    "all_of / any_of"_test = [] {
+        should("test every element until the result is known") = [] {
+            auto flags = std::vector<char>(1000, 1);
+            expect(cb::all_of(flags));
+            flags[700] = 0;
+            expect(not cb::all_of(flags));
+            expect(cb::any_of(flags.begin() + 700, flags.begin() + 701) == false);
+
+            auto const numbers = std::vector<int>{2, 4, 6, 7};
+            expect(cb::any_of(numbers, [](int x) { return x % 2 == 1; }));
+            expect(not cb::all_of(numbers, [](int x) { return x % 2 == 0; }));
+            expect(piped(numbers, cb::all_of([](int x) { return x > 0; })));
+            expect(not piped(numbers, cb::any_of(cb::identity, [](int x) { return x > 10; })));
+
+            auto evaluated = 0;
+            auto const counted = numbers | std::views::transform([&](int x) { ++evaluated; return x; });
+            expect(cb::any_of(counted, [](int x) { return x == 4; }));
+            expect(evaluated == 2_i);
+        };
+        should("be used by fold with logical_and and logical_or") = [] {
+            auto const numbers = std::vector<int>{1, 0, 3};
+            expect(cb::fold(numbers, true, cb::logical_and) == false);
+            expect(cb::fold(numbers, false, cb::logical_or) == true);
+            expect(cb::fold(numbers, cb::logical_and) == std::optional{false});
+            expect(not cb::fold(std::vector<int>{}, cb::logical_or).has_value());
+
+            auto evaluated = 0;
+            auto const counted = numbers | std::views::transform([&](int x) { ++evaluated; return x; });
+            expect(cb::fold(counted, true, cb::logical_and) == false);
+            expect(evaluated == 2_i);
+        };
+        static_assert(cb::all_of(std::array{true, true}));
+        static_assert(not cb::any_of(std::array{0, 0, 0}));
+    };
+
+    "select / compact"_test = [] {
+        auto numbers = std::vector<int>(1000);
+        for (auto i = 0; auto & n : numbers) {
+            n = (i++ * 7919) % 100 - 50;
+        }
+        // the positions and the values that a filtering loop would give
+        auto const filtered = [&](auto pred) {
+            auto positions = std::vector<std::size_t>{};
+            auto values = std::vector<int>{};
+            for (auto i = std::size_t{}; i < numbers.size(); ++i) {
+                if (pred(numbers[i])) {
+                    positions.push_back(i);
+                    values.push_back(numbers[i]);
+                }
+            }
+            return std::pair{positions, values};
+        };
+
+        should("select and compact the elements that satisfy the predicate, in order") = [=] {
+            auto const check = [&](auto pred) {
+                auto const [positions, values] = filtered(pred);
+                auto compacted = numbers;
+                auto const kept = cb::compact(compacted, pred);
+                return cb::select(numbers, pred) == positions and std::ranges::equal(kept, values)
+                    and kept.begin() == compacted.begin();
+            };
+            for (auto t : {-100, -50, -1, 0, 10, 49, 100}) {
+                expect(check(cb::less_than(t)));
+                expect(check(cb::greater_equal.left(t)));
+                expect(check(cb::not_equal_to(t)));
+                expect(check(cb::between(t, t + 20)));
+                expect(check(cb::less_than(static_cast<long>(t) - (1L << 40))));
+            }
+            expect(check([](int x) { return x % 3 == 0; }));
+        };
+        should("apply a projection, and compact elements that are not trivially copyable") = [] {
+            auto words = std::vector<std::string>{"a", "bb", "ccc", "dd", "e"};
+            expect(cb::select(words, cb::equal_to(2uz), &std::string::size) == std::vector<std::size_t>{1, 3});
+            auto const kept = cb::compact(words, cb::equal_to(2uz), &std::string::size);
+            expect(std::ranges::equal(kept, std::vector<std::string>{"bb", "dd"}));
+        };
+        should("accept non-contiguous ranges, and be piped") = [=] {
+            auto const list = std::list<int>{1, 5, 2, 7};
+            expect(cb::select(list, cb::greater_than(3)) == std::vector<std::size_t>{1, 3});
+            expect(piped(numbers, cb::select(cb::less_than(0))) == filtered(cb::less_than(0)).first);
+            expect(cb::select(std::vector<int>{}, cb::less_than(0)).empty());
+        };
+    };
+
+    "fold"_test = [] {
+        auto numbers = std::vector<long>(1'000'003);
+        std::iota(numbers.begin(), numbers.end(), 1);
+        auto const sum = 1'000'003L * 1'000'004L / 2;
+
+        should("fold from the left") = [=] {
+            expect(cb::fold(numbers, 0L, cb::plus) == sum);
+            expect(cb::fold(numbers, cb::plus).value() == sum);
+            expect(piped(numbers, cb::fold(cb::plus, 0L)) == sum);
+        };
+        should("give the same result with any execution policy") = [=] {
+            expect(cb::fold(numbers, 0L, cb::plus, cb::exec::seq) == sum);
+            expect(cb::fold(numbers, 0L, cb::plus, cb::exec::unseq) == sum);
+            expect(cb::fold(numbers, 7L, cb::plus, cb::exec::par) == sum + 7);
+            expect(cb::fold(numbers.begin(), numbers.end(), 0L, cb::plus, cb::exec::par_unseq) == sum);
+            expect(cb::fold(numbers, cb::bit_xor, cb::exec::par_unseq) == cb::fold(numbers, cb::bit_xor));
+            expect(piped(numbers, cb::fold(cb::plus, 0L, cb::exec::par)) == sum);
+            expect(piped(numbers, cb::fold(cb::plus, cb::exec::par_unseq)).value() == sum);
+        };
+        should("accumulate in the type of the fold, not in the type of the elements") = [] {
+            auto const large = std::vector<int>(100'000, std::numeric_limits<int>::max());
+            auto const expected = cb::fold(large, 0LL, cb::plus, cb::exec::seq);
+            expect(expected == 100'000LL * std::numeric_limits<int>::max());
+            expect(cb::fold(large, 0LL, cb::plus, cb::exec::par) == expected);
+            expect(cb::fold(large, 0LL, cb::plus, cb::exec::unseq) == expected);
+            expect(cb::fold(large, 0LL, cb::plus, cb::exec::par_unseq) == expected);
+        };
+        should("keep the order of non-commutative and non-associative operations") = [=] {
+            auto strings = std::vector<std::string>(50'000, "ab");
+            strings[7] = "x";
+            expect(cb::fold(strings, std::string{}, cb::plus, cb::exec::par_unseq)
+                   == cb::fold(strings, std::string{}, cb::plus));
+            expect(cb::fold(numbers, 0L, cb::minus, cb::exec::par) == -sum);
+        };
+        should("handle empty ranges") = [] {
+            auto const empty = std::vector<int>{};
+            expect(cb::fold(empty, 3, cb::plus, cb::exec::par) == 3_i);
+            expect(not cb::fold(empty, cb::plus, cb::exec::par_unseq).has_value());
+        };
+        should("fold the projections of the elements") = [] {
+            struct box { int id; double weight; };
+            auto boxes = std::vector<box>(40'000);
+            for (auto i = 0; auto & b : boxes) {
+                b = {i, static_cast<double>(i % 4) / 2};
+                ++i;
+            }
+            auto const total = 40'000 / 4 * 3.0;
+
+            expect(cb::fold(boxes, 0.0, cb::plus, &box::weight) == total);
+            expect(cb::fold(boxes.begin(), boxes.end(), 0.0, cb::plus, &box::weight) == total);
+            expect(cb::fold(boxes, cb::plus, &box::weight).value() == total);
+            expect(cb::fold(boxes, cb::bit_or, &box::id).value() == 65535_i);
+            expect(piped(boxes, cb::fold(cb::plus, 0.0, &box::weight)) == total);
+            expect(piped(boxes, cb::fold(cb::plus, 0.0, &box::weight, cb::exec::par_unseq)) == total);
+            expect(cb::fold(boxes, 0.0, cb::plus, &box::weight, cb::exec::par) == total);
+            expect(cb::fold(boxes, cb::plus, &box::weight, cb::exec::unseq).value() == total);
+            expect(not cb::fold(std::vector<box>{}, cb::plus, &box::weight).has_value());
+
+            auto const heavy = [](box const & b) { return b.weight > 1; };
+            expect(not cb::fold(boxes, true, cb::logical_and, heavy));
+            expect(cb::fold(boxes, false, cb::logical_or, heavy));
+        };
+        static_assert(cb::fold(std::array{1, 2, 3}, 0, cb::plus, cb::exec::par) == 6);
+        static_assert(cb::fold(std::array{1, 2, 3}, 0, cb::plus, cb::negate) == -6);
+    };
+
+    "sort"_test = [] {
+        // a linear congruential generator, to get the same numbers everywhere
+        auto random = [state = std::uint64_t{42}]() mutable {
+            state = state * 6364136223846793005u + 1442695040888963407u;
+            return static_cast<std::int32_t>(state >> 32);
+        };
+        auto integers = std::vector<int>(100'000);
+        std::ranges::generate(integers, random);
+
+        should("sort integers and floating points") = [=] {
+            auto sorted = integers;
+            cb::sort(sorted);
+            expect(std::ranges::is_sorted(sorted));
+            expect(std::ranges::is_permutation(sorted, integers));
+
+            auto reals = std::vector<double>(integers.begin(), integers.end());
+            std::ranges::transform(reals, reals.begin(), [](double x) { return x / 1000; });
+            reals[3] = -0.0;
+            reals[5] = std::numeric_limits<double>::infinity();
+            cb::sort(reals);
+            expect(std::ranges::is_sorted(reals));
+            cb::sort(reals, cb::greater_than);
+            expect(std::ranges::is_sorted(reals, std::ranges::greater{}));
+            expect(std::ranges::count_if(reals, [](double x) { return x == 0 and std::signbit(x); }) == 1_l);
+
+            // keys spread on more and on fewer bytes than their type
+            auto wide = std::vector<std::int64_t>(integers.begin(), integers.end());
+            std::ranges::transform(wide, wide.begin(), [](std::int64_t x) { return x * 1'000'003; });
+            auto narrow = std::vector<unsigned>(integers.begin(), integers.end());
+            std::ranges::transform(narrow, narrow.begin(), [](unsigned x) { return 4'000'000'000u + x % 1000; });
+            cb::sort(wide);
+            cb::sort(narrow);
+            expect(std::ranges::is_sorted(wide));
+            expect(std::ranges::is_sorted(narrow));
+        };
+        should("sort in descending order") = [=] {
+            auto sorted = integers;
+            cb::sort(sorted, cb::greater_than);
+            expect(std::ranges::is_sorted(sorted, std::ranges::greater{}));
+        };
+        should("sort on a projection, keeping the order of equal keys") = [=] {
+            struct item { std::uint8_t key; int position; };
+            auto items = std::vector<item>(integers.size());
+            for (auto i = 0uz; i < items.size(); ++i) {
+                items[i] = {static_cast<std::uint8_t>(integers[i]), static_cast<int>(i)};
+            }
+            cb::sort(items, cb::less_than, &item::key);
+            expect(std::ranges::is_sorted(items, [](item const & a, item const & b) {
+                return a.key < b.key or (a.key == b.key and a.position < b.position);
+            }));
+
+            // too many elements with too long keys are compared instead
+            auto pairs = std::vector<std::pair<std::int64_t, int>>(integers.size());
+            for (auto i = 0uz; i < pairs.size(); ++i) {
+                pairs[i] = {std::int64_t{integers[i]} << 32, integers[i]};
+            }
+            cb::sort(pairs, cb::greater_than, &std::pair<std::int64_t, int>::first);
+            expect(std::ranges::is_sorted(pairs, std::ranges::greater{}, &std::pair<std::int64_t, int>::first));
+        };
+        should("give the same result with any execution policy") = [=] {
+            auto expected = integers;
+            std::ranges::sort(expected);
+            auto sorted = integers;
+            expect(cb::sort(sorted, cb::exec::par) == expected);
+            sorted = integers;
+            expect(cb::sort.par(sorted.begin(), sorted.end()) == sorted.end());
+            expect(sorted == expected);
+            sorted = integers;
+            expect(cb::sort(cb::exec::par_unseq)(sorted) == expected);
+
+            auto strings = std::vector<std::string>(50'000);
+            std::ranges::transform(integers | std::views::take(50'000), strings.begin(),
+                                   [](int i) { return std::to_string(i); });
+            auto expected_strings = strings;
+            std::ranges::sort(expected_strings, std::ranges::greater{});
+            expect(cb::sort.par(strings, cb::greater_than) == expected_strings);
+        };
+        static_assert(cb::sort(std::array{3, 1, 2}, cb::exec::par) == std::array{1, 2, 3});
+    };
+}
@@ -8,6 +8,8 @@
 #include <filesystem>
 #include <brun/callables/arithmetic.hpp>
 #include <brun/callables/math.hpp>
+#include <limits>
+#include <type_traits>
 #define BOOST_UT_DISABLE_MODULE
 #include "boost/ut.hpp"
 
@@ -147,6 +149,37 @@ int main()
             expect(divides.right(20.)(-20.) == -1._d);
             expect(divides.right("abc")("def"_p).string() == "def/abc"_b) << divides.right("abc")("def"_p);
         };
+        should("bindable to compile-time constants") = [] {
+            using callables::c;
+            expect(divides.left<10>()(2) == 5_i);
+            expect(divides.right<8>()(-64) == -8_i);
+            expect(divides(c<20u>)(4u) == 5_u);
+            static_assert(divides.right<8>()(64) == 8);
+            static_assert(std::is_empty_v<decltype(divides.right<8>())>);
+            static_assert(std::is_empty_v<decltype(divides(c<8>))>);
+        };
+        should("divide by an invariant integer bound on the right") = [] {
+            for (auto d : {1, -1, 2, 3, -7, 10, 641, std::numeric_limits<int>::max(), std::numeric_limits<int>::min()}) {
+                auto const by_d = divides.right(d);
+                for (auto x : {0, 1, -1, 12345, -12345, std::numeric_limits<int>::max(), std::numeric_limits<int>::min() + 1}) {
+                    expect(by_d(x) == x / d) << x << '/' << d;
+                }
+            }
+            for (auto d : {1u, 3u, 10u, 0x8000'0001u, std::numeric_limits<unsigned>::max()}) {
+                expect(divides.right(d)(0xFFFF'FFFEu) == 0xFFFF'FFFEu / d) << d;
+            }
+            for (auto d : {3L, -10L, std::numeric_limits<long>::max()}) {
+                expect(divides.right(d)(std::numeric_limits<long>::min() + 1) == (std::numeric_limits<long>::min() + 1) / d);
+            }
+            expect(divides.right(8)(3.) == 0.375_d);
+            expect(divides.right(7)(int8_t{-50}) == -7_i);
+        };
+        should("bind a zero divisor") = [] {
+            constexpr auto inf = std::numeric_limits<double>::infinity();
+            expect(divides.right(0)(1.5) == inf);
+            expect(divides.right(0u)(-1.5) == -inf);
+            expect(divides.right(0L)(2.f) == std::numeric_limits<float>::infinity());
+        };
         should("callable with a pair argument") = [] {
             expect(divides.tuple(std::pair{10, 2}) == 5_i);
             expect(divides.tuple(std::pair{20., -20.}) == -1._d);
@@ -159,6 +192,48 @@ int main()
         };
     };
 
+    "modulus_fn"_test = [] {
+        using callables::modulus;
+        should("immediately evaluable") = [] {
+            expect(modulus(10, 3) == 1_i);
+            expect(modulus(-10, 3) == -1_i);
+            expect(modulus(10u, 4u) == 2_u);
+        };
+        should("partial-applicable") = [] {
+            expect(modulus(10)(3) == 1_i);
+            expect(modulus(10u)(4u) == 2_u);
+        };
+        should("left-bindable") = [] {
+            expect(modulus.left(10)(3) == 1_i);
+            expect(modulus.left(10u)(4u) == 2_u);
+        };
+        should("right-bindable") = [] {
+            expect(modulus.right(3)(10) == 1_i);
+            expect(modulus.right(4u)(10u) == 2_u);
+            expect(modulus.right<4>()(10) == 2_i);
+        };
+        should("take the remainder of an invariant integer bound on the right") = [] {
+            for (auto d : {1, -1, 2, 7, -769, std::numeric_limits<int>::min()}) {
+                auto const by_d = modulus.right(d);
+                for (auto x : {0, 1, -1, 12345, -12345, std::numeric_limits<int>::max(), std::numeric_limits<int>::min() + 1}) {
+                    expect(by_d(x) == x % d) << x << '%' << d;
+                }
+            }
+            for (auto d : {1UL, 769UL, std::numeric_limits<unsigned long>::max() - 1}) {
+                expect(modulus.right(d)(std::numeric_limits<unsigned long>::max()) == std::numeric_limits<unsigned long>::max() % d);
+            }
+        };
+        should("bind a zero divisor") = [] {
+            auto const by_zero = modulus.right(0);
+            auto const by_unsigned_zero = modulus.right(0UL);
+            expect(by_zero.bound().value() == 0_i);
+            expect(by_unsigned_zero.bound().value() == 0_ul);
+        };
+        should("callable with a pair argument") = [] {
+            expect(modulus.tuple(std::pair{10, 3}) == 1_i);
+        };
+    };
+
     "negate_fn"_test = [] {
         using callables::negate;
         should("immediately evaluable") = [] {
@@ -0,0 +1,112 @@
+######################################################################
+# @author      : Riccardo Brugo (brugo.riccardo@gmail.com)
+# @file        : compare_codegen
+# @created     : Saturday Oct 17, 2026 22:44:30 CEST
+#
+# Compiles SOURCE to assembly with COMPILER and FLAGS, then checks that no function `cb_<name>` has
+#  more instructions, memory accesses, register copies or calls than `raw_<name>`. The order of the
+#  instructions and the choice of registers are not compared, as they change with any scheduling
+#  decision of the compiler.
+#  Usage: cmake -DCOMPILER=<c++> -DFLAGS=<list> -DSOURCE=<file.cpp> -P compare_codegen.cmake
+######################################################################
+
+cmake_minimum_required(VERSION 3.16.2)
+
+execute_process(
+    COMMAND ${COMPILER} ${FLAGS} -S -o - ${SOURCE}
+    OUTPUT_VARIABLE assembly
+    ERROR_VARIABLE errors
+    RESULT_VARIABLE result
+)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "cannot compile ${SOURCE}:\n${errors}")
+endif()
+
+# one list element per line; `;` and brackets would be taken as list syntax
+string(REPLACE ";" "<semicolon>" assembly "${assembly}")
+string(REPLACE "[" "<" assembly "${assembly}")
+string(REPLACE "]" ">" assembly "${assembly}")
+string(REPLACE "\n" ";" lines "${assembly}")
+
+set(functions "")
+set(current "")
+foreach(line IN LISTS lines)
+    if (line MATCHES "^([A-Za-z_][A-Za-z0-9_.$]*):")
+        set(current "${CMAKE_MATCH_1}")
+        list(APPEND functions "${current}")
+        set(body_${current} "")
+    elseif (current STREQUAL "" OR line MATCHES "^[ \t]*(\\.|#|//|$)")
+        # directives, local labels and comments
+    else()
+        string(REGEX REPLACE "[ \t]+(#|//).*$" "" line "${line}")
+        string(REGEX REPLACE "\\.L[A-Za-z0-9_]+" ".L" line "${line}")
+        string(REGEX REPLACE "[ \t]+" " " line "${line}")
+        string(STRIP "${line}" line)
+        # references to the function itself, or to its cold part
+        string(REPLACE "cb_" "raw_" line "${line}")
+        list(APPEND body_${current} "${line}")
+    endif()
+endforeach()
+
+# Sets `<prefix>_instructions`, `<prefix>_memory`, `<prefix>_copies` and `<prefix>_calls` for a body
+function(count_instructions prefix body)
+    set(instructions 0)
+    set(memory 0)
+    set(copies 0)
+    set(calls 0)
+    foreach(line IN LISTS body)
+        math(EXPR instructions "${instructions} + 1")
+        if (line MATCHES "\\(|<" AND NOT line MATCHES "^lea")  # x86 and arm memory operands, not addresses
+            math(EXPR memory "${memory} + 1")
+        elseif (line MATCHES "^mov[a-z]* [%]?[a-z][a-z0-9]*, [%]?[a-z][a-z0-9]*$")
+            math(EXPR copies "${copies} + 1")
+        endif()
+        if (line MATCHES "^(call|bl|blr)[a-z]* " OR line MATCHES "^jmp [^.*]")  # calls and tail calls
+            math(EXPR calls "${calls} + 1")
+        endif()
+    endforeach()
+    foreach(counter instructions memory copies calls)
+        set(${prefix}_${counter} ${${counter}} PARENT_SCOPE)
+    endforeach()
+endfunction()
+
+set(compared 0)
+set(failures "")
+foreach(function IN LISTS functions)
+    if (NOT function MATCHES "^cb_(.*)$")
+        continue()
+    endif()
+    set(reference "raw_${CMAKE_MATCH_1}")
+    if (NOT reference IN_LIST functions)
+        list(APPEND failures "${function}: there is no ${reference} to compare with")
+        continue()
+    endif()
+    math(EXPR compared "${compared} + 1")
+    count_instructions(callable "${body_${function}}")
+    count_instructions(handwritten "${body_${reference}}")
+    set(excess "")
+    foreach(counter instructions memory copies calls)
+        if (callable_${counter} GREATER handwritten_${counter})
+            list(APPEND excess "${counter}: ${callable_${counter}} against ${handwritten_${counter}}")
+        endif()
+    endforeach()
+    if (excess)
+        list(JOIN excess ", " summary)
+        list(JOIN body_${function} "\n    " listing)
+        list(JOIN body_${reference} "\n    " reference_listing)
+        list(APPEND failures
+            "${function} is worse than ${reference} (${summary})\n"
+            "  ${function}:\n    ${listing}\n  ${reference}:\n    ${reference_listing}"
+        )
+    endif()
+endforeach()
+
+if (compared EQUAL 0)
+    message(FATAL_ERROR "no `cb_` function found in ${SOURCE}")
+endif()
+if (failures)
+    list(JOIN failures "\n" report)
+    string(REPLACE "<semicolon>" ";" report "${report}")
+    message(FATAL_ERROR "${report}")
+endif()
+message(STATUS "${compared} functions compile at least as well as their hand-written counterparts")
@@ -0,0 +1,39 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 22:38:52 CEST
+ * @description : codegen of `compose`; every `cb_<name>` must compile to the same code as `raw_<name>`
+ */
+
+#include <brun/callables/arithmetic.hpp>
+#include <brun/callables/combinators.hpp>
+
+#include <cstddef>
+#include <ranges>
+
+namespace cb = callables;
+
+extern "C" {
+auto cb_compose_two(int x) -> int { return cb::compose(cb::plus(1), cb::multiplies(3))(x); }
+auto raw_compose_two(int x) -> int { return 1 + 3 * x; }
+
+auto cb_compose_four(unsigned x) -> unsigned
+{
+    return cb::compose(cb::plus(1u), cb::multiplies(3u), cb::minus(7u), cb::multiplies(5u))(x);
+}
+auto raw_compose_four(unsigned x) -> unsigned { return 1u + 3u * (7u - 5u * x); }
+
+auto cb_compose_loop(int * data, std::size_t size) -> void
+{
+    auto const fn = cb::compose(cb::plus(1), cb::multiplies(3), cb::minus(7));
+    for (auto & x : std::ranges::subrange(data, data + size)) {
+        x = fn(x);
+    }
+}
+auto raw_compose_loop(int * data, std::size_t size) -> void
+{
+    auto const fn = [](int x) { return 1 + 3 * (7 - x); };
+    for (auto & x : std::ranges::subrange(data, data + size)) {
+        x = fn(x);
+    }
+}
+}
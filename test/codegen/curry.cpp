@@ -0,0 +1,35 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 22:41:26 CEST
+ * @description : codegen of `curry`; every `cb_<name>` must compile to the same code as `raw_<name>`
+ */
+
+#include <brun/callables/combinators.hpp>
+
+#include <cstddef>
+
+namespace cb = callables;
+
+constexpr auto multiply_add = [](long a, long b, long c) { return a * b + c; };
+
+extern "C" {
+auto cb_curry_once(long a, long b, long c) -> long { return cb::curry(multiply_add, a)(b, c); }
+auto raw_curry_once(long a, long b, long c) -> long { return a * b + c; }
+
+auto cb_curry_twice(long a, long b, long c) -> long { return cb::curry(cb::curry(multiply_add, a), b)(c); }
+auto raw_curry_twice(long a, long b, long c) -> long { return a * b + c; }
+
+auto cb_curry_loop(long * data, std::size_t size, long scale) -> void
+{
+    auto const fn = cb::curry(multiply_add, scale);
+    for (auto i = std::size_t{}; i < size; ++i) {
+        data[i] = fn(data[i], 1);
+    }
+}
+auto raw_curry_loop(long * data, std::size_t size, long scale) -> void
+{
+    for (auto i = std::size_t{}; i < size; ++i) {
+        data[i] = scale * data[i] + 1;
+    }
+}
+}
@@ -0,0 +1,52 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 22:36:15 CEST
+ * @description : codegen of `on`; every `cb_<name>` must compile to the same code as `raw_<name>`
+ */
+
+#include <brun/callables/combinators.hpp>
+#include <brun/callables/ordering.hpp>
+#include <brun/callables/arithmetic.hpp>
+
+#include <cstddef>
+
+namespace cb = callables;
+
+struct box
+{
+    int id;
+    double weight;
+};
+
+constexpr auto weight = [](box const & b) { return b.weight; };
+
+extern "C" {
+auto cb_on_less(box const & a, box const & b) -> bool { return cb::on(weight, cb::less_than)(a, b); }
+auto raw_on_less(box const & a, box const & b) -> bool { return a.weight < b.weight; }
+
+auto cb_on_plus(box const & a, box const & b, box const & c) -> double { return cb::on(weight, cb::plus)(a, b) + weight(c); }
+auto raw_on_plus(box const & a, box const & b, box const & c) -> double { return a.weight + b.weight + c.weight; }
+
+auto cb_heaviest(box const * boxes, std::size_t size) -> std::size_t
+{
+    auto const lighter = cb::on(weight, cb::less_than);
+    auto best = std::size_t{};
+    for (auto i = std::size_t{1}; i < size; ++i) {
+        if (lighter(boxes[best], boxes[i])) {
+            best = i;
+        }
+    }
+    return best;
+}
+auto raw_heaviest(box const * boxes, std::size_t size) -> std::size_t
+{
+    auto const lighter = [](box const & a, box const & b) { return a.weight < b.weight; };
+    auto best = std::size_t{};
+    for (auto i = std::size_t{1}; i < size; ++i) {
+        if (lighter(boxes[best], boxes[i])) {
+            best = i;
+        }
+    }
+    return best;
+}
+}
@@ -0,0 +1,53 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 22:31:08 CEST
+ * @description : codegen of `partial`, the left binding of binary function objects; every `cb_<name>` must compile to the same code as `raw_<name>`
+ */
+
+#include <brun/callables/arithmetic.hpp>
+#include <brun/callables/bit_operators.hpp>
+
+#include <cstddef>
+#include <ranges>
+
+namespace cb = callables;
+
+extern "C" {
+auto cb_plus(int x) -> int { return cb::plus(1)(x); }
+auto raw_plus(int x) -> int { return 1 + x; }
+
+auto cb_minus_double(double x) -> double { return cb::minus(0.5)(x); }
+auto raw_minus_double(double x) -> double { return 0.5 - x; }
+
+auto cb_bit_and_loop(unsigned * data, std::size_t size) -> void
+{
+    auto const mask = cb::bit_and(0xF0F0u);
+    for (auto & x : std::ranges::subrange(data, data + size)) {
+        x = mask(x);
+    }
+}
+auto raw_bit_and_loop(unsigned * data, std::size_t size) -> void
+{
+    auto const mask = [](unsigned x) { return 0xF0F0u & x; };
+    for (auto & x : std::ranges::subrange(data, data + size)) {
+        x = mask(x);
+    }
+}
+
+auto cb_transform_sum(int const * data, std::size_t size) -> long
+{
+    auto total = 0L;
+    for (auto x : std::ranges::subrange(data, data + size) | std::views::transform(cb::multiplies(3))) {
+        total += x;
+    }
+    return total;
+}
+auto raw_transform_sum(int const * data, std::size_t size) -> long
+{
+    auto total = 0L;
+    for (auto x : std::ranges::subrange(data, data + size) | std::views::transform([](int x) { return 3 * x; })) {
+        total += x;
+    }
+    return total;
+}
+}
@@ -0,0 +1,35 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Sunday Oct 18, 2026 03:41:08 CEST
+ * @description : codegen of `conjunction`, `disjunction` and `negation`; every `cb_<name>` must compile to the
+ *                same code as `raw_<name>`
+ */
+
+#include <brun/callables/ordering.hpp>
+#include <brun/callables/predicates.hpp>
+
+namespace cb = callables;
+
+struct person
+{
+    int age;
+    int id;
+};
+
+constexpr auto adult = [](person const & p) { return p.age >= 18; };
+// a clause that the hint moves in front of `adult`, as it rarely holds
+constexpr auto first_ids = cb::hint<1., .01>([](person const & p) { return p.id < 100; });
+
+extern "C" {
+auto cb_in_range(int x, int lo, int hi) -> bool { return cb::conjunction(cb::greater_equal(lo), cb::less_than(hi))(x); }
+auto raw_in_range(int x, int lo, int hi) -> bool { return x >= lo and x < hi; }
+
+auto cb_out_of_range(int x, int lo, int hi) -> bool { return cb::negation(cb::conjunction(cb::greater_equal(lo), cb::less_than(hi)))(x); }
+auto raw_out_of_range(int x, int lo, int hi) -> bool { return not (x >= lo and x < hi); }
+
+auto cb_either(int x, int lo, int hi) -> bool { return (cb::negation(cb::greater_equal(lo)) || cb::greater_equal(hi))(x); }
+auto raw_either(int x, int lo, int hi) -> bool { return x < lo or x >= hi; }
+
+auto cb_reordered(person const & p) -> bool { return (adult && first_ids)(p); }
+auto raw_reordered(person const & p) -> bool { return p.id < 100 and p.age >= 18; }
+}
@@ -0,0 +1,63 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 22:33:47 CEST
+ * @description : codegen of `right_partial`, the right binding of binary function objects and of comparisons; every `cb_<name>` must compile to the same code as `raw_<name>`
+ */
+
+#include <brun/callables/arithmetic.hpp>
+#include <brun/callables/ordering.hpp>
+
+#include <cstddef>
+#include <ranges>
+
+namespace cb = callables;
+
+extern "C" {
+auto cb_minus_right(int x) -> int { return cb::minus.right(1)(x); }
+auto raw_minus_right(int x) -> int { return x - 1; }
+
+auto cb_greater_equal(long x) -> bool { return cb::greater_equal(10)(x); }
+auto raw_greater_equal(long x) -> bool { return x >= 10; }
+
+auto cb_divides_constant(int x) -> int { return cb::divides.right<8>()(x); }
+auto raw_divides_constant(int x) -> int { return x / 8; }
+
+auto cb_less_constant(long x) -> bool { return cb::less_than(cb::c<100>)(x); }
+auto raw_less_constant(long x) -> bool { return x < 100; }
+
+auto cb_filter_sum(int const * data, std::size_t size) -> long
+{
+    auto total = 0L;
+    for (auto x : std::ranges::subrange(data, data + size) | std::views::filter(cb::greater_equal(10))) {
+        total += x;
+    }
+    return total;
+}
+auto raw_filter_sum(int const * data, std::size_t size) -> long
+{
+    auto total = 0L;
+    for (auto x : std::ranges::subrange(data, data + size) | std::views::filter([](int x) { return x >= 10; })) {
+        total += x;
+    }
+    return total;
+}
+
+auto cb_count_less(double const * data, std::size_t size, double bound) -> std::size_t
+{
+    auto const below = cb::less_than(bound);
+    auto count = std::size_t{};
+    for (auto i = std::size_t{}; i < size; ++i) {
+        count += below(data[i]);
+    }
+    return count;
+}
+auto raw_count_less(double const * data, std::size_t size, double bound) -> std::size_t
+{
+    auto const below = [bound](double x) { return x < bound; };
+    auto count = std::size_t{};
+    for (auto i = std::size_t{}; i < size; ++i) {
+        count += below(data[i]);
+    }
+    return count;
+}
+}
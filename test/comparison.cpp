@@ -6,6 +6,9 @@
  */
 
 #include <brun/callables/comparison.hpp>
+#include <ranges>
+#include <type_traits>
+#include <vector>
 #define BOOST_UT_DISABLE_MODULE
 #include "boost/ut.hpp"
 
@@ -56,6 +59,20 @@ int main()
             expect(equal_to.right(v.begin())(v.end()));
             expect(equal_to.right(nullptr)(doppleganger));
         };
+        should("take no storage for stateless bound values") = [=] {
+            using three = std::integral_constant<int, 3>;
+            static_assert(std::is_empty_v<decltype(equal_to.left(three{}))>);
+            static_assert(std::is_empty_v<decltype(equal_to.right(three{}))>);
+            static_assert(std::is_empty_v<decltype(equal_to(doppleganger))>);
+            static_assert(sizeof(equal_to(3)) == sizeof(int));
+            static_assert(std::is_trivially_copyable_v<decltype(equal_to.right(3))>);
+
+            auto const w = std::vector{1, 3, 5};
+            auto bound = w | std::views::filter(equal_to.right(three{}));
+            auto const lambda = w | std::views::filter([](int x) { return x == 3; });
+            static_assert(sizeof(bound) == sizeof(lambda));
+            expect(std::ranges::distance(bound) == 1_l);
+        };
         should("callable with a pair argument") = [=] {
             expect(equal_to.tuple(std::pair{1, 1}));
             expect(equal_to.tuple(std::pair{1., 1.}));
@@ -5,6 +5,8 @@
  */
 
 #include <brun/callables/format.hpp>
+#include <cmath>
+#include <limits>
 #define BOOST_UT_DISABLE_MODULE
 #include "boost/ut.hpp"
 
@@ -40,6 +42,46 @@ int main()
             expect(to_string("a") == "a");
             expect(to_string(point{10, -2}) == "(10, -2)");
         };
+        should("write in caller-provided storage") = [=] {
+            auto buffer = std::array<char, 8>{};
+            expect(std::string_view{buffer.data(), to_string.into(buffer, -42)} == "-42"sv);
+            auto str = std::string();
+            expect(to_string.to_string_into(str, point{1, 2}) == "(1, 2)"sv);
+        };
+        should("convert numbers, booleans and characters without std::format") = [=] {
+            expect(to_string(0) == "0"sv);
+            expect(to_string(std::numeric_limits<int>::min()) == "-2147483648"sv);
+            expect(to_string(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615"sv);
+            expect(to_string(static_cast<signed char>(-128)) == "-128"sv);
+            expect(to_string(true) == "true"sv);
+            expect(to_string('c') == "c"sv);
+            expect(to_string(-0.1) == std::format("{}", -0.1));
+        };
+        should("convert to an inline_string without allocating") = [=] {
+            expect(to_string.inline_<16>(-42) == "-42"sv);
+            expect(to_string.inline_<16>(point{3, 4}) == "(3, 4)"sv);
+            expect(to_string.inline_<11>(std::numeric_limits<int>::min()) == "-2147483648"sv);
+            expect(not to_string.inline_<16>(-42).truncated());
+            auto const numbers = std::array{1, 22, 333};
+            auto strings = numbers | std::views::transform(to_string.inline_<12>);
+            expect(strings[2] == "333"sv);
+        };
+        should("reject numbers that may not fit in an inline_string") = [] {
+            expect(not std::invocable<decltype(to_string.inline_<4>), int>);
+            expect(not std::invocable<decltype(to_string.inline_<10>), int>);
+            expect(not std::invocable<decltype(to_string.inline_<4>), bool>);
+            expect(not std::invocable<decltype(to_string.inline_<16>), double>);
+            expect(std::invocable<decltype(to_string.inline_<24>), double>);
+        };
+        should("report the strings that do not fit in an inline_string") = [] {
+            auto const label = to_string.inline_<4>("hello"sv);
+            expect(label == "hell"sv);
+            expect(label.truncated());
+            auto const pt = to_string.inline_<4>(point{3, 4});
+            expect(pt == "(3, "sv);
+            expect(pt.truncated());
+            expect(not to_string.inline_<6>(point{3, 4}).truncated());
+        };
     };
 
     "format"_test = [] {
@@ -50,6 +92,43 @@ int main()
             expect(format<"{1} {0}!">("todos", "hola") == std::string_view{"hola todos!"});
             expect(format<"{} = {}i + {}j">(point{9, 54}, 9, 54) == std::string_view{"(9, 54) = 9i + 54j"});
         };
+        should("write the formatted arguments in caller-provided storage") = [=] {
+            auto buffer = std::array<char, 16>{};
+            auto const size = format<"{} + {}">.into(buffer, 1, point{2, 3});
+            expect(std::string_view{buffer.data(), size} == "1 + (2, 3)"sv);
+            expect(format<"{} + {}">.formatted_size(1, point{2, 3}) == size);
+
+            auto const end = format<"{:>4}">.to(buffer.begin(), 7);
+            expect(std::string_view{buffer.begin(), end} == "   7"sv);
+
+            expect(format<"{}{}">.into(std::span{buffer}.first(3), "abc", "def") == 3_ul);
+            expect(std::string_view{buffer.data(), 3} == "abc"sv);
+
+            auto str = std::string();
+            str.reserve(64);
+            auto const capacity = str.capacity();
+            expect(format<"{}-{}">.to_string_into(str, 1, 2) == "1-2"sv);
+            expect(format<"{}">.to_string_into(str, "x") == "x"sv);
+            expect(str.capacity() == capacity);
+        };
+        should("give the same result when the format string is parsed at compile time") = [=] {
+            expect(format<"{}:{}">.compiled(42, "key") == "42:key"sv);
+            expect(format<"{{{}}} {}">.compiled(true, 'c') == "{true} c"sv);
+            expect(format<"{1}/{0}">.compiled(-1.5, 7u) == "7/-1.5"sv);
+            expect(format<"{:.3f}|{:>4}">.compiled(0.3, point{1, 2}) == std::format("{:.3f}|{:>4}", 0.3, point{1, 2}));
+            expect(format<"{:{}}">.compiled(7, 3) == "  7"sv);
+
+            auto buffer = std::array<char, 16>{};
+            auto const end = format<"id-{}">.compiled.to(buffer.begin(), 123);
+            expect(std::string_view{buffer.begin(), end} == "id-123"sv);
+            auto str = std::string();
+            expect(format<"{}{}">.compiled.to_string_into(str, "ab", 1) == "ab1"sv);
+        };
+        should("check the format string against the arguments at compile time") = [] {
+            expect(std::invocable<decltype(format<"{:d}">.compiled), int>);
+            expect(not std::invocable<decltype(format<"{:d}">.compiled), char const (&)[2]>);
+            expect(not std::invocable<decltype(format<"{} {}">.compiled), int>);
+        };
     };
 
     "ston"_test = [] {
@@ -115,6 +194,55 @@ int main()
                     };
                 };
             };
+            when("many base-10 integers are parsed at once") = [=] {
+                auto fields = std::array<std::string_view, 6>{
+                    "0", "-2147483648", "123456789", "00000000000000000000042", "2147483648", "12a"
+                };
+                then("each result must follow the result policy") = [=] {
+                    auto results = std::array<std::optional<int>, 6>{};
+                    callables::ston<int, 10, callables::policy::use_optional>.batch(fields, results);
+                    expect(results[0].value() == 0_i);
+                    expect(results[1].value() == std::numeric_limits<int>::min());
+                    expect(results[2].value() == 123456789_i);
+                    expect(results[3].value() == 42_i);
+                    expect(not results[4].has_value());
+                    expect(not results[5].has_value());
+                };
+                then("must return the written results") = [=] {
+                    auto results = std::array<int, 4>{};
+                    auto written = ston<int>.batch(std::span{fields}.first(4), results);
+                    expect(written.size() == 4_ul);
+                    expect(results == std::array{0, std::numeric_limits<int>::min(), 123456789, 42});
+                };
+            };
+            when("a floating point is parsed from a non-contiguous range") = [=] {
+                constexpr auto stod = callables::ston<double, 10, callables::policy::use_optional>;
+                auto const parse = [=](std::string_view str) {
+                    return stod(str | std::views::filter([](char) { return true; }));
+                };
+                then("must give the same result as from_chars") = [=] {
+                    for (auto str : {"0.1"sv, "-654.321"sv, "1e23"sv, "2.2250738585072011e-308"sv,
+                                     "9007199254740993"sv, "123456789012345678901234567890e-5"sv}) {
+                        auto expected = 0.;
+                        std::from_chars(str.data(), str.data() + str.size(), expected);
+                        expect(parse(str).value() == expected) << str;
+                    }
+                    expect(parse("-inf").value() == -std::numeric_limits<double>::infinity());
+                    expect(parse("infinity").value() == std::numeric_limits<double>::infinity());
+                };
+                then("must stop at the terminator of a string literal") = [=] {
+                    auto const all = [](char) { return true; };
+                    expect(stod("inf" | std::views::filter(all)).value() == std::numeric_limits<double>::infinity());
+                    expect(stod("-Infinity" | std::views::filter(all)).value() == -std::numeric_limits<double>::infinity());
+                    expect(std::isnan(stod("nan" | std::views::filter(all)).value()));
+                    expect(not stod("infin" | std::views::filter(all)).has_value());
+                };
+                then("must fail on invalid characters") = [=] {
+                    expect(not parse("12.3.4").has_value());
+                    expect(not parse("1e").has_value());
+                    expect(not parse("").has_value());
+                };
+            };
             when("a non-base-10 integer is parsed with an appropriate base") = [=] {
                 auto cstr = "010101";
                 auto strv = std::string_view{"123AF"};
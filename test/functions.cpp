@@ -6,6 +6,10 @@
  */
 
 #include <brun/callables/functions.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
 #define BOOST_UT_DISABLE_MODULE
 #include "boost/ut.hpp"
 
@@ -36,6 +40,16 @@ struct member_get
     std::array<int, 3> x;
     template <std::size_t N> auto get() { return std::get<N>(x); }
 };
+
+// a function that can be built from anything, remembering if it was
+struct wrapper
+{
+    bool wraps = false;
+    wrapper() = default;
+    template <typename T> requires (not std::same_as<std::remove_cvref_t<T>, wrapper>)
+    wrapper(T &&) : wraps{true} {}
+    auto operator()(int n) const { return wraps ? -1 : n; }
+};
 }  // namespace test
 
 
@@ -96,6 +110,43 @@ int main()
             expect(compose(twice, sum)(2, 3) == 10_i) << twice_expr << ", " << sum_expr << "with 2, 3";
             expect(compose(twice, sum)(1, 2, 3) == 12_i) << twice_expr << ", " << sum_expr << "with 1, 2, 3";
         };
+        should("flatten nested compositions and long pipelines") = [&] {
+            auto const inc = [](int n) { return n + 1; };
+            expect(compose(compose(twice, inc), compose(inc, square))(2) == 12_i);
+            auto const pipeline = compose(
+                inc, inc, inc, inc, inc, inc, inc, inc, inc, inc, inc, inc,
+                inc, inc, inc, inc, inc, inc, inc, inc, inc, inc, inc, twice
+            );
+            expect(pipeline(1) == 25_i);
+        };
+        should("be empty and trivially copyable if the functions are") = [&] {
+            using composition = decltype(compose(twice, sum));
+            static_assert(std::is_empty_v<composition>);
+            static_assert(std::is_trivially_copyable_v<composition>);
+            auto const offset = 3;
+            static_assert(sizeof(compose(twice, [offset](int n) { return n + offset; })) == sizeof(int));
+        };
+        should("be copied, not wrapped, by functions that can be built from anything") = [] {
+            auto composition = compose(test::wrapper{});
+            auto const copy = decltype(composition)(composition);
+            expect(copy(3) == 3_i);
+            auto function = compose(std::function<int(int)>{[](int n) { return n + 1; }});
+            auto const function_copy = decltype(function)(function);
+            expect(function_copy(3) == 4_i);
+        };
+        should("move the intermediate results, without copying them") = [] {
+            auto const make = [](int n) { return std::make_unique<int>(n); };
+            auto const read = [](std::unique_ptr<int> p) { return *p; };
+            auto const pass = [](std::unique_ptr<int> p) { return p; };
+            expect(compose(read, pass, pass, make)(7) == 7_i);
+        };
+        should("return by value what the first function returns by reference") = [] {
+            auto const make_string = [](int n) { return std::string(32, static_cast<char>('0' + n)); };
+            auto const forward = [](std::string && s) -> std::string && { return std::move(s); };
+            expect(compose(callables::identity, make_string)(3) == std::string(32, '3'));
+            expect(compose(forward, make_string)(4) == std::string(32, '4'));
+            expect(std::same_as<decltype(compose(forward, make_string)(4)), std::string>);
+        };
     };
 
     "on_fn"_test = [] {
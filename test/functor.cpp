@@ -0,0 +1,254 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Sunday Oct 18, 2026 04:20:37 CEST
+ * @description :
+ */
+
+#include <brun/callables/functional/functor.hpp>
+#define BOOST_UT_DISABLE_MODULE
+#include "boost/ut.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <map>
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cb = callables;
+
+// the elements of maps can't be printed by `boost.ut`, so they're compared out of `expect`
+template <typename Map>
+auto same_map(Map const & lhs, Map const & rhs) -> bool
+{
+    return lhs == rhs;
+}
+
+int main()
+{
+    using namespace boost::ut;
+    using namespace boost::ut::operators::terse;
+
+    "fmap over std::vector"_test = [] {
+        auto const triple = [](int x) { return x * 3; };
+
+        should("map every element, whatever the value category of the vector") = [=] {
+            auto const numbers = std::vector{1, 2, 3};
+            auto mutable_numbers = numbers;
+            expect(cb::fmap(triple, numbers) == std::vector{3, 6, 9});
+            expect(cb::fmap(triple, mutable_numbers) == std::vector{3, 6, 9});
+            expect(cb::fmap([](int x) { return x * .5; }, numbers) == std::vector{.5, 1., 1.5});
+            expect(cb::fmap([](int x) { return std::to_string(x); }, numbers) == std::vector<std::string>{"1", "2", "3"});
+            expect(cb::fmap(triple, std::vector<int>{}).empty());
+        };
+        should("reuse the buffer of an rvalue when the type does not change") = [=] {
+            auto numbers = std::vector(1000, 1);
+            auto const buffer = numbers.data();
+            auto const tripled = cb::fmap(triple, std::move(numbers));
+            expect(tripled.data() == buffer);
+            expect(tripled == std::vector(1000, 3));
+
+            auto words = std::vector<std::string>{"a", "b"};
+            auto const first = words.data();
+            auto const longer = cb::fmap([](std::string && s) { return std::move(s) + s; }, std::move(words));
+            expect(longer.data() == first);
+            expect(longer == std::vector<std::string>{"aa", "bb"});
+
+            auto const halves = cb::fmap([](int x) { return x * .5f; }, std::vector{2, 4});
+            expect(halves == std::vector{1.f, 2.f});
+        };
+        should("move the elements out of an rvalue") = [] {
+            auto pointers = std::vector<std::unique_ptr<int>>{};
+            pointers.push_back(std::make_unique<int>(7));
+            auto const values = cb::fmap([](std::unique_ptr<int> && p) { return std::optional{*p}; }, std::move(pointers));
+            expect(values == std::vector{std::optional{7}});
+        };
+    };
+
+    "fmap over std::optional and std::array"_test = [] {
+        expect(cb::fmap([](int x) { return x + 1; }, std::optional{1}) == std::optional{2});
+        expect(cb::fmap([](int x) { return x + 1; }, std::array{1, 2}) == std::array{2, 3});
+    };
+
+    "fmap over spans, deques and maps"_test = [] {
+        auto const triple = [](int x) { return x * 3; };
+
+        should("map a span into a vector or into another span") = [=] {
+            auto numbers = std::vector{1, 2, 3};
+            expect(cb::fmap(triple, std::span{numbers}) == std::vector{3, 6, 9});
+            auto out = std::array<double, 4>{0, 0, 0, -1};
+            auto const written = cb::fmap([](int x) { return x * .5; }, std::span{numbers}, std::span{out});
+            expect(written.data() == out.data());
+            expect(written.size() == 3_u);
+            expect(out == std::array{.5, 1., 1.5, -1.});
+            expect(cb::fmap(triple, std::span{numbers}, std::span{numbers}).size() == 3_u);
+            expect(numbers == std::vector{3, 6, 9});
+        };
+#if defined __cpp_lib_mdspan
+        should("map an mdspan into another one with the same extents") = [=] {
+            using extents_t = std::dextents<std::size_t, 2>;
+            auto const numbers = std::array{1, 2, 3, 4, 5, 6};
+            auto dense = std::array<int, 6>{};
+            cb::fmap(triple, std::mdspan(numbers.data(), 2, 3), std::mdspan(dense.data(), 2, 3));
+            expect(dense == std::array{3, 6, 9, 12, 15, 18});
+
+            // a column-major 2x3 output, with a padding element after each column
+            auto strided = std::array<int, 9>{};
+            auto const mapping = std::layout_stride::mapping<extents_t>(extents_t(2, 3), std::array<std::size_t, 2>{1, 3});
+            auto const out = std::mdspan<int, extents_t, std::layout_stride>(strided.data(), mapping);
+            cb::fmap(triple, std::mdspan(numbers.data(), 2, 3), out);
+            expect(strided == std::array{3, 12, 0, 6, 15, 0, 9, 18, 0});
+        };
+#endif
+        should("map a deque, in place if it is an rvalue of the same type") = [=] {
+            auto const numbers = std::deque<int>(1000, 2);
+            expect(cb::fmap(triple, numbers) == std::deque<int>(1000, 6));
+            expect(cb::fmap([](int x) { return std::to_string(x); }, numbers)[999] == "2");
+            auto copy = numbers;
+            auto const first = &copy.front();
+            auto const tripled = cb::fmap(triple, std::move(copy));
+            expect(&tripled.front() == first);
+            expect(tripled == std::deque<int>(1000, 6));
+        };
+        should("map the values of maps and keep their keys") = [=] {
+            auto const ages = std::map<std::string, int>{{"a", 1}, {"b", 2}};
+            expect(same_map(cb::fmap(triple, ages), {{"a", 3}, {"b", 6}}));
+            auto const halves = cb::fmap([](int x) { return x * .5; }, ages);
+            expect(same_map(halves, {{"a", .5}, {"b", 1.}}));
+
+            auto const repeated = std::multimap<int, int>{{1, 1}, {1, 2}, {0, 3}};
+            expect(std::ranges::equal(cb::fmap(triple, repeated), std::multimap<int, int>{{0, 9}, {1, 3}, {1, 6}}));
+
+            auto const hashed = std::unordered_map<int, int>{{1, 1}, {2, 2}};
+            expect(same_map(cb::fmap(triple, hashed), {{1, 3}, {2, 6}}));
+        };
+        should("reuse the nodes of an rvalue map, or move its keys") = [=] {
+            auto ages = std::map<std::string, int>{{"a", 1}, {"b", 2}};
+            auto const first = &*ages.begin();
+            auto const tripled = cb::fmap(triple, std::move(ages));
+            expect(&*tripled.begin() == first);
+            expect(same_map(tripled, {{"a", 3}, {"b", 6}}));
+
+            auto words = std::unordered_map<std::string, std::string>{{std::string(100, 'k'), "v"}};
+            auto const sizes = cb::fmap([](std::string && s) { return s.size(); }, std::move(words));
+            expect(same_map(sizes, {{std::string(100, 'k'), 1}}));
+            expect(words.empty());
+        };
+    };
+
+    "fmap with an output allocator"_test = [] {
+        auto const triple = [](int x) { return x * 3; };
+        auto buffer = std::array<std::byte, 4096>{};
+        auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        auto const in_arena = [&](auto const * address) {
+            auto const byte = reinterpret_cast<std::byte const *>(address);
+            return byte >= buffer.data() and byte < buffer.data() + buffer.size();
+        };
+
+        should("allocate the result in a memory resource") = [&] {
+            auto const numbers = std::vector{1, 2, 3};
+            auto const tripled = cb::fmap(triple, numbers, &arena);
+            static_assert(std::same_as<decltype(tripled), std::pmr::vector<int> const>);
+            expect(tripled == std::pmr::vector<int>{3, 6, 9});
+            expect(in_arena(tripled.data()));
+
+            auto const halves = cb::fmap([](int x) { return x * .5; }, std::span{numbers}, std::pmr::polymorphic_allocator<>(&arena));
+            expect(in_arena(halves.data()));
+            expect(in_arena(&cb::fmap(triple, std::deque{1}, &arena).front()));
+            auto const ages = cb::fmap(triple, std::map<int, int>{{1, 1}}, &arena);
+            expect(in_arena(&*ages.begin()));
+            expect(ages.at(1) == 3_i);
+        };
+        should("not reuse the buffer of an rvalue") = [&] {
+            auto numbers = std::vector{1, 2, 3};
+            auto const tripled = cb::fmap(triple, std::move(numbers), &arena);
+            expect(in_arena(tripled.data()));
+            expect(numbers.size() == 3_u);
+            expect(in_arena(cb::fmap(triple, cb::fmap.lazy(triple, std::vector{1})).eval(&arena).data()));
+        };
+        should("keep the allocator of the source otherwise") = [&] {
+            auto const numbers = std::pmr::vector<int>({1, 2, 3}, &arena);
+            auto const halves = cb::fmap([](int x) { return x * .5; }, numbers);
+            expect(halves.get_allocator().resource() == &arena);
+            expect(cb::fmap(triple, numbers, cb::exec::par).get_allocator().resource() == &arena);
+        };
+    };
+
+    "fmap with an execution policy"_test = [] {
+        auto const triple = [](int x) { return x * 3; };
+        auto numbers = std::vector<int>(100'000);
+        std::iota(numbers.begin(), numbers.end(), -50'000);
+        auto const expected = cb::fmap(triple, numbers);
+
+        should("give the same results as the sequential map") = [&] {
+            expect(cb::fmap.par(triple, numbers) == expected);
+            expect(cb::fmap(triple, numbers, cb::exec::par_unseq, 1000) == expected);
+            expect(cb::fmap(triple, numbers, cb::exec::seq) == expected);
+            expect(cb::fmap.par(triple, std::span{numbers}) == expected);
+            expect(cb::fmap.par([](int x) { return std::to_string(x); }, numbers, 1000)[99'999] == "49999");
+            expect(cb::fmap.par([](int x) { return x > 0; }, numbers, 1000) == cb::fmap([](int x) { return x > 0; }, numbers));
+            expect(cb::fmap.par(triple, std::vector<int>{}).empty());
+        };
+        should("map small inputs and other functors sequentially") = [=] {
+            expect(cb::fmap.par(triple, std::vector{1, 2}, 1) == std::vector{3, 6});
+            expect(cb::fmap.par(triple, std::array{1, 2, 3}, 1) == std::array{3, 6, 9});
+            expect(cb::fmap.par(triple, std::optional{2}) == std::optional{6});
+        };
+        should("reuse the buffer of an rvalue") = [&] {
+            auto copy = numbers;
+            auto const buffer = copy.data();
+            auto const tripled = cb::fmap.par(triple, std::move(copy), 1000);
+            expect(tripled.data() == buffer);
+            expect(tripled == expected);
+        };
+    };
+
+    "lazy fmap"_test = [] {
+        auto const triple = [](int x) { return x * 3; };
+        auto const half = [](int x) { return x * .5; };
+
+        should("fuse the maps and apply them once") = [=] {
+            auto const numbers = std::vector{1, 2, 3};
+            auto calls = 0;
+            auto const counted = [&calls](int x) { ++calls; return x + 1; };
+            auto const lazy = cb::fmap(half, cb::fmap(triple, cb::fmap.lazy(counted, numbers)));
+            expect(calls == 0_i);
+            expect(lazy.eval() == std::vector{3., 4.5, 6.});
+            expect(calls == 3_i);
+            expect(cb::fmap.lazy(half, cb::fmap.lazy(triple, numbers)).eval() == std::vector{1.5, 3., 4.5});
+            expect(cb::fmap.lazy(triple, std::optional{2}).eval() == std::optional{6});
+            expect(cb::fmap(triple, cb::fmap.lazy(triple, std::array{1, 2})).eval() == std::array{9, 18});
+            expect(cb::fmap.lazy(half, cb::fmap.lazy(triple, numbers)).eval(cb::exec::par, 1) == std::vector{1.5, 3., 4.5});
+        };
+        should("borrow lvalues and own rvalues") = [=] {
+            auto numbers = std::vector{1, 2};
+            auto const borrowed = cb::fmap.lazy(triple, numbers);
+            numbers[0] = 10;
+            expect(borrowed.eval() == std::vector{30, 6});
+
+            auto owned = std::vector(1000, 1);
+            auto const buffer = owned.data();
+            auto lazy = cb::fmap(triple, cb::fmap.lazy(triple, std::move(owned)));
+            auto const result = std::move(lazy).eval();
+            expect(result.data() == buffer);
+            expect(result == std::vector(1000, 9));
+        };
+        should("build other containers from the mapped elements") = [=] {
+            auto const numbers = std::vector{1, 2, 3};
+            auto const lazy = cb::fmap(triple, cb::fmap.lazy(triple, numbers));
+            expect(lazy.to<std::vector<int>>() == std::vector{9, 18, 27});
+            expect(lazy.to<std::deque<double>>() == std::deque{9., 18., 27.});
+            expect(cb::fmap.lazy(triple, std::vector{1}).to<std::deque<int>>() == std::deque{3});
+        };
+    };
+}
@@ -0,0 +1,132 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Sunday Oct 18, 2026 03:52:19 CEST
+ * @description :
+ */
+
+#include <brun/callables/ordering.hpp>
+#include <brun/callables/predicates.hpp>
+#define BOOST_UT_DISABLE_MODULE
+#include "boost/ut.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cb = callables;
+
+struct person
+{
+    int age;
+    std::string name;
+};
+
+// records the order in which the clauses are evaluated
+inline auto evaluated = std::string{};
+
+constexpr auto adult = [](person const & p) { evaluated += 'a'; return p.age >= 18; };
+constexpr auto joe = [](person const & p) { evaluated += 'j'; return p.name == "Joe"; };
+
+template <typename Junction, std::size_t Idx>
+using clause_t = std::tuple_element_t<Idx, decltype(Junction::_clauses)>;
+
+int main()
+{
+    using namespace boost::ut;
+    using namespace boost::ut::operators::terse;
+
+    "conjunction / disjunction / negation"_test = [] {
+        should("combine the results of the predicates") = [] {
+            constexpr auto in_range = cb::conjunction(cb::greater_equal(0), cb::less_than(10));
+            static_assert(in_range(0) and in_range(9) and not in_range(10) and not in_range(-1));
+            constexpr auto out_of_range = cb::disjunction(cb::less_than(0), cb::greater_equal(10));
+            static_assert(out_of_range(-1) and out_of_range(10) and not out_of_range(5));
+            constexpr auto outside = cb::negation(in_range);
+            static_assert(outside(-1) and outside(10) and not outside(5));
+            static_assert(cb::negation(cb::less_than(3))(3));
+        };
+        should("be empty if the predicates are empty") = [] {
+            expect(std::is_empty_v<decltype(cb::conjunction(adult, joe))>);
+            expect(std::is_empty_v<decltype(cb::negation(cb::disjunction(adult, joe)))>);
+            expect(sizeof(cb::conjunction(cb::less_than(1), cb::greater_than(2))) == 2 * sizeof(int));
+        };
+        should("flatten nested junctions and simplify negations") = [] {
+            auto const flat = cb::conjunction(cb::conjunction(adult, joe), adult);
+            expect(std::tuple_size_v<decltype(flat._clauses)> == 3_u);
+            auto const outside = cb::negation(cb::conjunction(cb::greater_equal(0), cb::less_than(10)));
+            expect(not decltype(outside)::is_conjunction);
+            expect(std::same_as<decltype(cb::negation(cb::negation(adult))), std::remove_const_t<decltype(adult)>>);
+            expect(std::same_as<decltype(cb::negation(outside)), decltype(cb::conjunction(cb::greater_equal(0), cb::less_than(10)))>);
+        };
+        should("evaluate first the clauses most likely to decide the result for their cost") = [] {
+            auto const rare_joe = cb::hint<1.5, .01>(joe);  // slower than `adult`, but almost never true
+            auto const ann = person{30, "Ann"};
+
+            evaluated.clear();
+            expect(not cb::conjunction(adult, rare_joe)(ann));
+            expect(evaluated == "j");
+            evaluated.clear();
+            expect(cb::disjunction(rare_joe, adult)(ann));
+            expect(evaluated == "a");
+
+            // without hints the order is kept
+            evaluated.clear();
+            expect(not cb::conjunction(joe, adult)(ann));
+            expect(evaluated == "j");
+
+            // expensive clauses go last, unless they decide the result much more often
+            auto const slow_adult = cb::hint<100.>(adult);
+            evaluated.clear();
+            expect(not cb::conjunction(slow_adult, joe)(ann));
+            expect(evaluated == "j");
+            expect(std::same_as<clause_t<decltype(cb::conjunction(slow_adult, joe)), 1>, std::remove_const_t<decltype(slow_adult)>>);
+        };
+        should("combine hints") = [] {
+            using both = decltype(cb::conjunction(cb::hint<1., .5>(adult), cb::hint<1., .1>(joe)));
+            expect(cb::predicate_selectivity<both> == .05_d);
+            expect(cb::predicate_cost<both> == 1.1_d);  // `joe`, then `adult` for 1 in 10 arguments
+            using either = decltype(cb::disjunction(cb::hint<1., .5>(adult), cb::hint<1., .1>(joe)));
+            expect(cb::predicate_selectivity<either> == .55_d);
+            expect(cb::predicate_selectivity<decltype(cb::negation(cb::hint<1., .2>(adult)))> == .8_d);
+        };
+    };
+
+    "operators"_test = [] {
+        auto const ann = person{30, "Ann"};
+        should("combine predicate expressions with any predicate") = [=] {
+            auto const rare_joe = cb::hint<1.5, .01>(joe);
+            auto const adult_joe = adult and rare_joe;
+            expect(not adult_joe(ann));
+            expect((adult or rare_joe)(ann));
+            expect((not rare_joe)(ann));
+            expect(std::same_as<std::remove_const_t<decltype(adult_joe)>, decltype(cb::conjunction(adult, rare_joe))>);
+        };
+        should("combine any predicates within callables::operators") = [=] {
+            using namespace callables::operators;
+            auto const filtered = std::vector<int>{-5, 0, 5, 10, 15};
+            auto const in_range = cb::greater_equal(0) and cb::less_than(10);
+            auto count = 0;
+            for (auto x : filtered) {
+                count += in_range(x);
+            }
+            expect(count == 2_i);
+            expect((adult or joe)(ann));
+            expect(not (not adult)(ann));
+        };
+        should("leave the built-in operators to classes convertible to bool") = [] {
+            using namespace callables::operators;
+            auto const some = std::optional{1};
+            auto const none = std::optional<int>{};
+            auto const ptr = std::unique_ptr<int>{};
+            expect(std::same_as<decltype(some and none), bool>);
+            expect(std::same_as<decltype(some or ptr), bool>);
+            expect(std::same_as<decltype(not ptr), bool>);
+            expect(not (some and none));
+            expect(some or none);
+            expect(not ptr);
+        };
+    };
+}
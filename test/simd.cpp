@@ -0,0 +1,116 @@
+/**
+ * @author      : Riccardo Brugo (brugo.riccardo@gmail.com)
+ * @file        : simd
+ * @created     : Sunday Oct 18, 2026 02:14:36 CEST
+ * @description :
+ */
+
+#include <brun/callables/simd.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#define BOOST_UT_DISABLE_MODULE
+#include "boost/ut.hpp"
+
+namespace cb = callables;
+
+// the elements around `0` and both ends of `X`, `size` in total
+template <typename X>
+auto make_values(std::size_t size)
+{
+    auto values = std::vector<X>{std::numeric_limits<X>::min(), std::numeric_limits<X>::max()};
+    for (auto i = std::size_t{}; values.size() < size; ++i) {
+        values.push_back(static_cast<X>(static_cast<int>(i % 64) - 20));
+    }
+    return values;
+}
+
+// whether `simd::eval` gives the same results as calling `pred` on each element, in both outputs
+template <typename X, typename Pred>
+auto same_as_scalar(Pred const & pred, std::vector<X> const & values) -> bool
+{
+    auto mask = std::vector<std::uint8_t>(values.size(), 2);
+    auto bits = std::vector<std::uint64_t>((values.size() + 63) / 64, ~std::uint64_t{});
+    auto const mask_count = cb::simd::eval(pred, values, std::span{mask});
+    auto const bits_count = cb::simd::eval(pred, values, std::span{bits});
+    auto count = std::size_t{};
+    for (auto i = std::size_t{}; i < values.size(); ++i) {
+        auto const expected = static_cast<bool>(pred(values[i]));
+        count += expected;
+        if (mask[i] != expected or static_cast<bool>((bits[i / 64] >> (i % 64)) & 1) != expected) {
+            return false;
+        }
+    }
+    auto const tail = values.size() % 64 == 0 or bits.back() >> (values.size() % 64) == 0;
+    return tail and mask_count == count and bits_count == count;
+}
+
+template <typename X, typename V>
+auto all_same_as_scalar(std::size_t size, V v) -> bool
+{
+    auto const values = make_values<X>(size);
+    return same_as_scalar(cb::less_than(v), values) and same_as_scalar(cb::less_equal(v), values)
+        and same_as_scalar(cb::greater_than(v), values) and same_as_scalar(cb::greater_equal(v), values)
+        and same_as_scalar(cb::equal_to(v), values) and same_as_scalar(cb::not_equal_to(v), values)
+        and same_as_scalar(cb::less_than.left(v), values) and same_as_scalar(cb::greater_equal.left(v), values)
+        and same_as_scalar(cb::between(v, static_cast<V>(v + 10)), values)
+        and same_as_scalar(cb::between(static_cast<V>(v + 10), v), values);
+}
+
+struct box { int width; double weight; };
+
+int main()
+{
+    using namespace boost::ut;
+    using namespace boost::ut::operators::terse;
+
+    "simd_eval"_test = [] {
+        should("match the scalar predicate on bound comparisons and between") = [] {
+            for (auto v : {-1000LL, -129LL, -128LL, -1LL, 0LL, 5LL, 127LL, 128LL, 256LL, 1LL << 40}) {
+                expect(all_same_as_scalar<int>(1000, v));
+                expect(all_same_as_scalar<unsigned>(999, v));
+                expect(all_same_as_scalar<std::int8_t>(130, v));
+                expect(all_same_as_scalar<std::uint64_t>(64, v));
+                expect(all_same_as_scalar<int>(100, static_cast<int>(v)));
+                expect(all_same_as_scalar<unsigned>(100, static_cast<unsigned>(v)));
+            }
+            expect(all_same_as_scalar<int>(70, std::numeric_limits<long>::min()));
+            expect(all_same_as_scalar<std::uint64_t>(70, std::numeric_limits<std::uint64_t>::max()));
+        };
+        should("match the scalar predicate on compile-time constants and other predicates") = [] {
+            auto const values = make_values<int>(200);
+            expect(same_as_scalar(cb::greater_equal.right<0>(), values));
+            expect(same_as_scalar(cb::equal_to.left<3>(), values));
+            expect(same_as_scalar(cb::less_than(2.5), values));
+            expect(same_as_scalar([](int x) { return x % 3 == 0; }, values));
+            expect(same_as_scalar(cb::less_than(2), std::vector{1.0, -2.0, 3.5}));
+        };
+        should("select all or no elements without testing them") = [] {
+            auto const values = make_values<std::int8_t>(100);
+            auto bits = std::vector<std::uint64_t>(2);
+            expect(cb::simd::eval(cb::less_equal(1000), values, std::span{bits}) == 100_u);
+            expect(bits[0] == ~std::uint64_t{} and bits[1] == (std::uint64_t{1} << 36) - 1);
+            expect(cb::simd::eval(cb::not_equal_to(1000), values, std::span{bits}) == 100_u);
+            expect(cb::simd::eval(cb::greater_than(1000), values, std::span{bits}) == 0_u);
+            expect(bits[0] == 0_ull);
+            expect(bits[1] == 0_ull);
+            expect(cb::simd::eval(cb::between(10, -10), values, std::span{bits}) == 0_u);
+        };
+        should("apply a projection") = [] {
+            auto const boxes = std::vector<box>{{1, 0.5}, {5, 1.5}, {-3, 2.0}};
+            auto mask = std::vector<std::uint8_t>(3);
+            expect(cb::simd::eval(cb::greater_than(0), boxes, std::span{mask}, &box::width) == 2_u);
+            expect(mask == std::vector<std::uint8_t>{1, 1, 0});
+            auto bits = std::vector<std::uint64_t>(1);
+            expect(cb::simd::eval(cb::between(1.0, 2.0), boxes, std::span{bits}, &box::weight) == 2_u);
+            expect(bits[0] == 6_ull);
+        };
+        should("handle empty ranges") = [] {
+            auto const values = std::vector<int>{};
+            expect(cb::simd::eval(cb::less_than(0), values, std::span<std::uint8_t>{}) == 0_u);
+            expect(cb::simd::eval(cb::less_than(0), values, std::span<std::uint64_t>{}) == 0_u);
+        };
+    };
+}
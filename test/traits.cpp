@@ -0,0 +1,61 @@
+/**
+ * @author      : rbrugo (brugo.riccardo@gmail.com)
+ * @created     : Saturday Oct 17, 2026 18:31:02 CEST
+ * @description : 
+ */
+
+#include <brun/callables/traits.hpp>
+#include <brun/callables/combinators.hpp>
+#include <brun/callables/math.hpp>
+#define BOOST_UT_DISABLE_MODULE
+#include "boost/ut.hpp"
+
+#include <cstdint>
+
+namespace cb = callables;
+
+template <typename Op>
+using flipped = decltype(cb::flip(Op{}));
+
+int main()
+{
+    using namespace boost::ut;
+    using namespace boost::ut::bdd;
+    using namespace boost::ut::operators;
+    using namespace boost::ut::operators::terse;
+
+    "monoid_traits"_test = [] {
+        should("describe the operators as monoids") = [] {
+            static_assert(cb::monoid<cb::plus_fn, int>);
+            static_assert(cb::monoid<cb::multiplies_fn, double>);
+            static_assert(cb::monoid<cb::bit_xor_fn, std::uint8_t>);
+            static_assert(cb::monoid<cb::logical_or_fn, bool>);
+            static_assert(not cb::monoid<cb::minus_fn, int>);
+            static_assert(not cb::monoid<cb::bit_and_fn, float>);
+            static_assert(not cb::monoid<cb::plus_fn, bool>);
+
+            expect(cb::monoid_traits<cb::plus_fn, int>::identity() == 0_i);
+            expect(cb::monoid_traits<cb::multiplies_fn, long>::identity() == 1_l);
+            expect(cb::monoid_traits<cb::bit_and_fn, std::uint16_t>::identity() == std::uint16_t{0xFFFF});
+            expect(cb::monoid_traits<cb::logical_and_fn, bool>::identity());
+            expect(cb::monoid_traits<cb::bit_or_fn, int>::is_commutative);
+        };
+        should("be kept by flip") = [] {
+            static_assert(cb::monoid<flipped<cb::plus_fn>, int>);
+            static_assert(cb::monoid<decltype(cb::flip(cb::bit_or)), unsigned>);
+            static_assert(not cb::monoid<flipped<cb::minus_fn>, int>);
+            expect(cb::monoid_traits<flipped<cb::multiplies_fn>, int>::identity() == 1_i);
+        };
+    };
+
+    "is_commutative"_test = [] {
+        should("follow the binary operation through on and compose") = [] {
+            static_assert(cb::is_commutative<decltype(cb::on(cb::abs, cb::plus))>);
+            static_assert(not cb::is_associative<decltype(cb::on(cb::abs, cb::plus))>);
+            static_assert(not cb::is_commutative<decltype(cb::on(cb::abs, cb::minus))>);
+            static_assert(cb::is_commutative<decltype(cb::compose(cb::abs, cb::multiplies))>);
+            static_assert(not cb::is_commutative<decltype(cb::compose(cb::multiplies, cb::abs))>);
+            static_assert(cb::is_commutative<flipped<cb::bit_and_fn>>);
+        };
+    };
+}